@@ -5,6 +5,7 @@ import time
 import uuid
 import argparse
 import sqlite3
+import struct
 import subprocess
 from dataclasses import dataclass, asdict
 from urllib.parse import urlparse, parse_qs
@@ -19,6 +20,24 @@ DEFAULT_HTML   = os.path.join(HERE, "sensor.html")
 DEFAULT_LOG    = os.path.join(HERE, "gyro_log.ndjson")
 DEFAULT_LATEST = os.path.join(HERE, "latest.json")
 
+# =========================
+# Binary IMU wire format ("bin1")
+# =========================
+# little-endian, packed: u8 magic, u8 version, u16 device_idx, f64 ts_ms,
+# f32 yaw pitch roll ax ay az gx gy gz, u32 buttons (bit0 = fire)
+# version 2 (hub -> UE) appends f64 hub_rx_ms, f64 hub_tx_ms for latency tracing
+# version 3 appends u32 seq (per-device packet counter) after those; phones send the hub stamps as 0
+IMU_FORMAT_BIN = "bin1"
+IMU_MAGIC = 0xB1
+IMU_VERSION = 1
+IMU_VERSION_HUB_STAMPS = 2
+IMU_STRUCT = struct.Struct("<BBHd9fI")
+IMU_STRUCT_HUB_STAMPS = struct.Struct("<BBHd9fIdd")
+IMU_VERSION_SEQ = 3
+IMU_STRUCT_SEQ = struct.Struct("<BBHd9fIddI")
+IMU_FIELDS = ("yaw", "pitch", "roll", "ax", "ay", "az", "gx", "gy", "gz")
+BTN_FIRE = 1 << 0
+
 # =========================
 # Data Models
 # =========================
@@ -33,6 +52,7 @@ class ClientInfo:
     recv_count: int = 0
     match_id: str = ""
     in_queue: bool = False
+    imu_format: str = "json"  # UE only: "json" or IMU_FORMAT_BIN
 
 @dataclass
 class MatchInfo:
@@ -57,6 +77,9 @@ waiting_queue: list[str] = []       # list of phone uids
 matches: dict[str, MatchInfo] = {}  # match_id -> MatchInfo
 
 latest_by_uid: dict[str, dict] = {} # uid -> last json payload
+dev_idx_by_uid: dict[str, int] = {} # uid -> dense index used by binary frames
+announced_by_ws: dict = {}          # ue ws -> {uid: (idx, name, match_id)} last device_index sent
+device_list_version = 0             # bumped per device_connected/device_disconnected, sent as "ver"
 recv_total = 0
 
 LOG_PATH = DEFAULT_LOG
@@ -124,6 +147,77 @@ async def send_to_uid(uid: str, obj) -> bool:
         return False
     return await send_json(w, obj)
 
+def get_dev_idx(uid: str) -> int:
+    idx = dev_idx_by_uid.get(uid)
+    if idx is None:
+        idx = len(dev_idx_by_uid)
+        dev_idx_by_uid[uid] = idx
+    return idx
+
+def num_or_zero(v) -> float:
+    return float(v) if isinstance(v, (int, float)) else 0.0
+
+def pack_imu(idx: int, obj: dict) -> bytes:
+    ts = num_or_zero(obj.get("ts", obj.get("tsMs", obj.get("ts_ms"))))
+    buttons = obj.get("buttons")
+    if not isinstance(buttons, int):
+        buttons = BTN_FIRE if obj.get("fire") else 0
+    seq = obj.get("seq")
+    seq = seq if isinstance(seq, int) else 0
+    return IMU_STRUCT_SEQ.pack(IMU_MAGIC, IMU_VERSION_SEQ, idx, ts,
+                               *(num_or_zero(obj.get(k)) for k in IMU_FIELDS), buttons & 0xFFFFFFFF,
+                               num_or_zero(obj.get("hub_rx")), num_or_zero(obj.get("hub_tx")), seq & 0xFFFFFFFF)
+
+def unpack_imu(raw: bytes):
+    """Binary frame from a phone -> imu dict (uid/name come from the connection)."""
+    if len(raw) < 2 or raw[0] != IMU_MAGIC:
+        return None
+    if raw[1] == IMU_VERSION and len(raw) == IMU_STRUCT.size:
+        vals = IMU_STRUCT.unpack(raw)
+    elif raw[1] == IMU_VERSION_SEQ and len(raw) == IMU_STRUCT_SEQ.size:
+        vals = IMU_STRUCT_SEQ.unpack(raw)
+    else:
+        return None
+    obj = {"type": "imu", "ts": vals[3]}
+    obj.update(zip(IMU_FIELDS, (round(v, 3) for v in vals[4:13])))
+    obj["buttons"] = vals[13]
+    obj["fire"] = 1 if vals[13] & BTN_FIRE else 0
+    if raw[1] == IMU_VERSION_SEQ:
+        obj["seq"] = vals[16]
+    return obj
+
+async def broadcast_imu(info: ClientInfo, obj: dict):
+    """imu fan-out: each UE gets JSON or bin1 as negotiated; both are encoded at most once."""
+    obj["hub_tx"] = round(now() * 1000.0, 3)
+    text = None
+    packed = None
+    idx = get_dev_idx(info.uid)
+    dead = []
+    for w, ci in list(clients_by_ws.items()):
+        if ci.role != "ue":
+            continue
+        try:
+            if ci.imu_format == IMU_FORMAT_BIN and idx <= 0xFFFF:
+                key = (idx, info.name, info.match_id)
+                announced = announced_by_ws.setdefault(w, {})
+                if announced.get(info.uid) != key:
+                    await w.send(json_dumps({
+                        "type": "device_index", "idx": idx,
+                        "uid": info.uid, "name": info.name, "match_id": info.match_id
+                    }))
+                    announced[info.uid] = key
+                if packed is None:
+                    packed = pack_imu(idx, obj)
+                await w.send(packed)
+            else:
+                if text is None:
+                    text = json_dumps({"type": "imu", **obj})
+                await w.send(text)
+        except Exception:
+            dead.append(w)
+    for w in dead:
+        await drop_client(w)
+
 def remove_from_queue(uid: str):
     global waiting_queue
     if uid in waiting_queue:
@@ -376,6 +470,42 @@ async def abort_match(match_id: str, reason: str):
     await send_to_uid(m.p2_uid, payload)
     await broadcast_to_role("ue", payload)
 
+# =========================
+# Device list (versioned deltas)
+# =========================
+async def announce_phone(typ: str, uid: str, info: ClientInfo):
+    global device_list_version
+    device_list_version += 1
+    await broadcast_to_role("ue", {
+        "type": typ,
+        "server_ts": now(),
+        "ver": device_list_version,
+        "uid": uid,
+        "name": info.name,
+        "role": info.role,
+        "remote": info.remote
+    })
+
+def build_device_list() -> dict:
+    devices = []
+    for ci in clients_by_ws.values():
+        # skip connections whose uid was taken over by a newer one
+        if ci.role == "phone" and clients_by_ws.get(ws_by_uid.get(ci.uid)) is ci:
+            devices.append({
+                "uid": ci.uid,
+                "name": ci.name,
+                "role": ci.role,
+                "remote": ci.remote,
+                "connected_at": ci.connected_at,
+                "last_seen": ci.last_seen,
+            })
+    return {
+        "type": "device_list",
+        "server_ts": now(),
+        "ver": device_list_version,
+        "devices": devices
+    }
+
 # =========================
 # Client lifecycle
 # =========================
@@ -393,8 +523,9 @@ async def drop_client(ws):
         "match_id": info.match_id
     }
 
-    # remove mapping
-    if ws_by_uid.get(info.uid) == ws:
+    # remove mapping (a reconnect may already own the uid)
+    owned_uid = ws_by_uid.get(info.uid) == ws
+    if owned_uid:
         ws_by_uid.pop(info.uid, None)
 
     # remove from queue
@@ -408,17 +539,11 @@ async def drop_client(ws):
             await abort_match(mid, reason=f"disconnect:{info.uid}")
 
     clients_by_ws.pop(ws, None)
+    announced_by_ws.pop(ws, None)
 
-    # notify UE about phone disconnect
-    if info.role == "phone":
-        await broadcast_to_role("ue", {
-            "type": "device_disconnected",
-            "server_ts": now(),
-            "uid": info.uid,
-            "name": info.name,
-            "role": info.role,
-            "remote": info.remote
-        })
+    # notify UE about phone disconnect, unless a newer connection took the uid over
+    if info.role == "phone" and owned_uid:
+        await announce_phone("device_disconnected", info.uid, info)
 
     try:
         await ws.close()
@@ -453,6 +578,8 @@ async def ws_handler(ws, path):
         uid=uid_q, name=name_q, role=role_q,
         remote=remote, connected_at=now(), last_seen=now()
     )
+    if role_q == "ue" and (qs.get("imu", [""])[0] or "").strip() == IMU_FORMAT_BIN:
+        info.imu_format = IMU_FORMAT_BIN
     clients_by_ws[ws] = info
     ws_by_uid[info.uid] = ws
 
@@ -469,43 +596,37 @@ async def ws_handler(ws, path):
 
     # NEW: phone connect -> notify UE
     if info.role == "phone":
-        await broadcast_to_role("ue", {
-            "type": "device_connected",
-            "server_ts": now(),
-            "uid": info.uid,
-            "name": info.name,
-            "role": info.role,
-            "remote": info.remote
-        })
+        await announce_phone("device_connected", info.uid, info)
 
-    # NEW: UE connect -> send current phone list once
+    # NEW: UE connect -> send current phone list once; after that UE follows the deltas
     if info.role == "ue":
-        devices = []
-        for ci in clients_by_ws.values():
-            if ci.role == "phone":
-                devices.append({
-                    "uid": ci.uid,
-                    "name": ci.name,
-                    "remote": ci.remote,
-                    "connected_at": ci.connected_at,
-                    "last_seen": ci.last_seen,
-                })
-        await send_json(ws, {
-            "type": "device_list",
-            "server_ts": now(),
-            "devices": devices
-        })
+        await send_json(ws, build_device_list())
 
     try:
         async for raw in ws:
+            rx_ms = now() * 1000.0
             recv_total += 1
             info.recv_count += 1
             info.last_seen = now()
 
+            obj = None
             if isinstance(raw, (bytes, bytearray)):
-                raw = raw.decode("utf-8", errors="ignore")
+                obj = unpack_imu(raw) if info.role == "phone" else None
+                if obj is None:
+                    raw = raw.decode("utf-8", errors="ignore")
 
-            obj = json_loads_safe(raw)
+            if obj is None:
+                obj = json_loads_safe(raw)
+
+            # heartbeat: answered before logging so pings do not flood gyro_log / the DB
+            if obj.get("type") == "ping":
+                await send_json(ws, {"type": "pong", "id": obj.get("id"), "server_ts": now()})
+                continue
+
+            # UE missed a delta (version gap): resend the full list
+            if obj.get("type") == "device_list_request" and info.role == "ue":
+                await send_json(ws, build_device_list())
+                continue
 
             # normalize uid/name only (role fixed)
             typ = (obj.get("type") or "").strip()
@@ -514,10 +635,15 @@ async def ws_handler(ws, path):
 
             # if uid changed, update mapping
             if obj_uid != info.uid:
-                if ws_by_uid.get(info.uid) == ws:
+                owned_uid = ws_by_uid.get(info.uid) == ws
+                if owned_uid:
                     ws_by_uid.pop(info.uid, None)
+                if info.role == "phone" and owned_uid:
+                    await announce_phone("device_disconnected", info.uid, info)
                 info.uid = obj_uid
                 ws_by_uid[info.uid] = ws
+                if info.role == "phone":
+                    await announce_phone("device_connected", info.uid, info)
             info.name = obj_name
 
             # match_id in payload or inferred
@@ -549,7 +675,10 @@ async def ws_handler(ws, path):
 
             # ============ Protocol handling ============
             if typ == "hello":
-                await send_json(ws, {"type": "hello_ack", "server_ts": now(), "uid": info.uid})
+                if info.role == "ue" and (obj.get("imu_format") or "") == IMU_FORMAT_BIN:
+                    info.imu_format = IMU_FORMAT_BIN
+                await send_json(ws, {"type": "hello_ack", "server_ts": now(), "uid": info.uid,
+                                     "imu_format": info.imu_format})
                 continue
 
             if typ == "join_request":
@@ -589,9 +718,10 @@ async def ws_handler(ws, path):
             if typ == "imu":
                 if info.match_id:
                     obj["match_id"] = info.match_id
+                obj["hub_rx"] = round(rx_ms, 3)
 
-                # broadcast to all UE listeners
-                await broadcast_to_role("ue", {"type": "imu", **obj}, exclude_ws=None)
+                # broadcast to all UE listeners (JSON or bin1 per listener)
+                await broadcast_imu(info, obj)
 
                 # optional: send to opponent phone
                 if info.match_id:
@@ -1,13 +1,17 @@
 #include "SWICharacter.h"
-#include "AbilitySystemComponent.h"
+#include "SWICharacterMovementComponent.h"
+#include "SWI/GameplayAbilities/SWIAbilitySystemComponent.h"
+#include "SWI/GameplayAbilities/SWIGameplayAbility.h"
 #include "GameplayEffect.h"
 #include "GameplayAbilitySpec.h"
 
-ASWICharacter::ASWICharacter()
+ASWICharacter::ASWICharacter(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<USWICharacterMovementComponent>(ACharacter::CharacterMovementComponentName))
 {
-	PrimaryActorTick.bCanEverTick = true;
+	// Nothing to do per frame; gyro timeouts are the hub's watchdog. Blueprint children with Event Tick still tick.
+	PrimaryActorTick.bCanEverTick = false;
 
-	AbilitySystemComponent = CreateDefaultSubobject<UAbilitySystemComponent>(TEXT("ASC"));
+	AbilitySystemComponent = CreateDefaultSubobject<USWIAbilitySystemComponent>(TEXT("ASC"));
 	AbilitySystemComponent->SetIsReplicated(true);
 	AbilitySystemComponent->SetReplicationMode(EGameplayEffectReplicationMode::Mixed);
 
@@ -30,15 +34,47 @@ void ASWICharacter::BeginPlay()
 		AbilitySystemComponent->ApplyGameplayEffectSpecToSelf(*Spec.Data.Get());
 	}
 
+	// Specs replicate to the owning client; granting there is ignored.
+	if (!HasAuthority()) return;
+
 	for (const TSubclassOf<UGameplayAbility>& AbilityClass : StartupAbilities)
 	{
 		if (!AbilityClass) continue;
-		AbilitySystemComponent->GiveAbility(FGameplayAbilitySpec(AbilityClass, 1));
+
+		FGameplayAbilitySpec AbilitySpec(AbilityClass, 1);
+		if (const USWIGameplayAbility* SWIAbility = Cast<USWIGameplayAbility>(AbilityClass->GetDefaultObject()))
+		{
+			AbilitySpec.GetDynamicSpecSourceTags().AddTag(SWIAbility->InputTag);
+		}
+		AbilitySystemComponent->GiveAbility(AbilitySpec);
 	}
 }
 
+void ASWICharacter::PossessedBy(AController* NewController)
+{
+	Super::PossessedBy(NewController);
 
-void ASWICharacter::Tick(float DeltaSeconds)
+	// Predicted activation needs the controller in the actor info, which BeginPlay may not have had yet.
+	AbilitySystemComponent->InitAbilityActorInfo(this, this);
+}
+
+void ASWICharacter::OnRep_Controller()
 {
-	Super::Tick(DeltaSeconds);	
-}
\ No newline at end of file
+	Super::OnRep_Controller();
+	AbilitySystemComponent->InitAbilityActorInfo(this, this);
+}
+
+UAbilitySystemComponent* ASWICharacter::GetAbilitySystemComponent() const
+{
+	return AbilitySystemComponent;
+}
+
+USWIAbilitySystemComponent* ASWICharacter::GetSWIAbilitySystem() const
+{
+	return Cast<USWIAbilitySystemComponent>(AbilitySystemComponent);
+}
+
+USWICharacterMovementComponent* ASWICharacter::GetSWIMovement() const
+{
+	return Cast<USWICharacterMovementComponent>(GetCharacterMovement());
+}
@@ -2,25 +2,34 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
+#include "AbilitySystemInterface.h"
 #include "SWI/SWIHubProtocolTypes.h"
 #include "SWICharacter.generated.h"
 
 class USWISensorReceiverComponent;
 class UAbilitySystemComponent;
+class USWIAbilitySystemComponent;
 class UAttributeSet;
 class UGameplayEffect;
 class UGameplayAbility;
+class USWICharacterMovementComponent;
 
 UCLASS()
-class SWI_API ASWICharacter : public ACharacter
+class SWI_API ASWICharacter : public ACharacter, public IAbilitySystemInterface
 {
 	GENERATED_BODY()
 
 public:
-	ASWICharacter();
+	ASWICharacter(const FObjectInitializer& ObjectInitializer);
 
 	virtual void BeginPlay() override;
-	virtual void Tick(float DeltaSeconds) override;
+	virtual void PossessedBy(AController* NewController) override;
+	virtual void OnRep_Controller() override;
+
+	virtual UAbilitySystemComponent* GetAbilitySystemComponent() const override;
+	USWIAbilitySystemComponent* GetSWIAbilitySystem() const;
+
+	USWICharacterMovementComponent* GetSWIMovement() const;
 
 protected:
 	TObjectPtr<USWISensorReceiverComponent> SensorReceiverComp;
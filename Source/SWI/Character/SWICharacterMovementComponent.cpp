@@ -0,0 +1,126 @@
+#include "SWICharacterMovementComponent.h"
+#include "GameFramework/Character.h"
+
+// ---- Network move data ----
+
+void FSWIGyroNetworkMoveData::ClientFillNetworkMoveData(const FSavedMove_Character& ClientMove, ENetworkMoveType MoveType)
+{
+	FCharacterNetworkMoveData::ClientFillNetworkMoveData(ClientMove, MoveType);
+
+	const FSavedMove_SWIGyro& GyroMove = static_cast<const FSavedMove_SWIGyro&>(ClientMove);
+	bGyroDriving = GyroMove.bGyroDriving;
+}
+
+bool FSWIGyroNetworkMoveData::Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap, ENetworkMoveType MoveType)
+{
+	FCharacterNetworkMoveData::Serialize(CharacterMovement, Ar, PackageMap, MoveType);
+
+	uint8 Driving = bGyroDriving ? 1 : 0;
+	Ar.SerializeBits(&Driving, 1);
+	bGyroDriving = Driving != 0;
+
+	return !Ar.IsError();
+}
+
+FSWIGyroNetworkMoveDataContainer::FSWIGyroNetworkMoveDataContainer()
+{
+	NewMoveData = &GyroMoves[0];
+	PendingMoveData = &GyroMoves[1];
+	OldMoveData = &GyroMoves[2];
+}
+
+// ---- Saved move ----
+
+void FSavedMove_SWIGyro::Clear()
+{
+	FSavedMove_Character::Clear();
+	bGyroDriving = false;
+}
+
+void FSavedMove_SWIGyro::SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData)
+{
+	FSavedMove_Character::SetMoveFor(C, InDeltaTime, NewAccel, ClientData);
+
+	if (const USWICharacterMovementComponent* Move = Cast<USWICharacterMovementComponent>(C->GetCharacterMovement()))
+	{
+		bGyroDriving = Move->bGyroDriving;
+	}
+}
+
+void FSavedMove_SWIGyro::PrepMoveFor(ACharacter* C)
+{
+	FSavedMove_Character::PrepMoveFor(C);
+
+	// Replays after a correction run with the gyro state the move was made with.
+	if (USWICharacterMovementComponent* Move = Cast<USWICharacterMovementComponent>(C->GetCharacterMovement()))
+	{
+		Move->bGyroDriving = bGyroDriving;
+	}
+}
+
+bool FSavedMove_SWIGyro::CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const
+{
+	const FSavedMove_SWIGyro* Other = static_cast<const FSavedMove_SWIGyro*>(NewMove.Get());
+
+	// The move that starts or stops gyro driving must reach the server on its own, not folded into the next one.
+	if (bGyroDriving != Other->bGyroDriving)
+	{
+		return false;
+	}
+	return FSavedMove_Character::CanCombineWith(NewMove, InCharacter, MaxDelta);
+}
+
+// ---- Movement component ----
+
+USWICharacterMovementComponent::USWICharacterMovementComponent()
+{
+	SetNetworkMoveDataContainer(GyroMoveDataContainer);
+}
+
+void USWICharacterMovementComponent::SetGyroInput(bool bDriving)
+{
+	bGyroDriving = bDriving;
+}
+
+FNetworkPredictionData_Client* USWICharacterMovementComponent::GetPredictionData_Client() const
+{
+	if (!ClientPredictionData)
+	{
+		USWICharacterMovementComponent* MutableThis = const_cast<USWICharacterMovementComponent*>(this);
+		MutableThis->ClientPredictionData = new FNetworkPredictionData_Client_SWIGyro(*this);
+	}
+	return ClientPredictionData;
+}
+
+void USWICharacterMovementComponent::UpdateCharacterStateBeforeMovement(float DeltaSeconds)
+{
+	Super::UpdateCharacterStateBeforeMovement(DeltaSeconds);
+
+	// Inside the move, so client prediction and the server switch on the same move and nothing is corrected.
+	if (bGyroDriving && MovementMode == MOVE_None)
+	{
+		SetMovementMode(MOVE_Walking);
+	}
+}
+
+void USWICharacterMovementComponent::MoveAutonomous(float ClientTimeStamp, float DeltaTime, uint8 CompressedFlags, const FVector& NewAccel)
+{
+	// Server: take the gyro state of the client move being processed.
+	if (const FSWIGyroNetworkMoveData* MoveData = static_cast<const FSWIGyroNetworkMoveData*>(GetCurrentNetworkMoveData()))
+	{
+		bGyroDriving = MoveData->bGyroDriving;
+	}
+
+	Super::MoveAutonomous(ClientTimeStamp, DeltaTime, CompressedFlags, NewAccel);
+}
+
+bool USWICharacterMovementComponent::ClientUpdatePositionAfterServerUpdate()
+{
+	// Replayed moves restore their own gyro state; the live input is what the next move must use.
+	const bool bRealDriving = bGyroDriving;
+
+	const bool bResult = Super::ClientUpdatePositionAfterServerUpdate();
+
+	bGyroDriving = bRealDriving;
+	return bResult;
+}
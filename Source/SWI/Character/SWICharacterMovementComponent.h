@@ -0,0 +1,80 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/CharacterMovementReplication.h"
+#include "SWICharacterMovementComponent.generated.h"
+
+// Gyro state carried by each client move: one bit, whether a phone drives the pawn.
+struct FSWIGyroNetworkMoveData : public FCharacterNetworkMoveData
+{
+	bool bGyroDriving = false;
+
+	virtual void ClientFillNetworkMoveData(const FSavedMove_Character& ClientMove, ENetworkMoveType MoveType) override;
+	virtual bool Serialize(UCharacterMovementComponent& CharacterMovement, FArchive& Ar, UPackageMap* PackageMap, ENetworkMoveType MoveType) override;
+};
+
+struct FSWIGyroNetworkMoveDataContainer : public FCharacterNetworkMoveDataContainer
+{
+	FSWIGyroNetworkMoveDataContainer();
+
+	FSWIGyroNetworkMoveData GyroMoves[3];
+};
+
+/**
+ * Character movement that replicates the phone's input with the client's saved moves.
+ *
+ * Gyro move and look already reach the server like any stick: as the move's acceleration and the compressed control
+ * rotation, predicted and reconciled by the character movement code and combined per net update. What that path
+ * lacks is whether a phone drives the pawn, so that bit rides along in the packed move data: a pawn placed with
+ * MOVE_None starts walking on client and server on the same move, and replays restore it. Moves with different gyro
+ * state are never combined. Buttons reach the server as ability activations, not through the move. Raw IMU never
+ * leaves the machine that owns the hub.
+ */
+UCLASS()
+class SWI_API USWICharacterMovementComponent : public UCharacterMovementComponent
+{
+	GENERATED_BODY()
+
+public:
+	USWICharacterMovementComponent();
+
+	// Called by the owning controller every frame before the pawn moves (locally controlled or server-side phone).
+	void SetGyroInput(bool bDriving);
+
+	virtual FNetworkPredictionData_Client* GetPredictionData_Client() const override;
+
+protected:
+	virtual void UpdateCharacterStateBeforeMovement(float DeltaSeconds) override;
+	virtual void MoveAutonomous(float ClientTimeStamp, float DeltaTime, uint8 CompressedFlags, const FVector& NewAccel) override;
+	virtual bool ClientUpdatePositionAfterServerUpdate() override;
+
+private:
+	friend class FSavedMove_SWIGyro;
+
+	bool bGyroDriving = false;
+
+	FSWIGyroNetworkMoveDataContainer GyroMoveDataContainer;
+};
+
+class FSavedMove_SWIGyro : public FSavedMove_Character
+{
+public:
+	bool bGyroDriving = false;
+
+	virtual void Clear() override;
+	virtual void SetMoveFor(ACharacter* C, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData) override;
+	virtual void PrepMoveFor(ACharacter* C) override;
+	virtual bool CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const override;
+};
+
+class FNetworkPredictionData_Client_SWIGyro : public FNetworkPredictionData_Client_Character
+{
+public:
+	explicit FNetworkPredictionData_Client_SWIGyro(const UCharacterMovementComponent& ClientMovement)
+		: FNetworkPredictionData_Client_Character(ClientMovement)
+	{
+	}
+
+	virtual FSavedMovePtr AllocateNewMove() override { return FSavedMovePtr(new FSavedMove_SWIGyro()); }
+};
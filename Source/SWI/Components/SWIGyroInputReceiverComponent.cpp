@@ -7,14 +7,14 @@
 USWIGyroInputReceiverComponent::USWIGyroInputReceiverComponent()
 {
 	PrimaryComponentTick.bCanEverTick = true;
+	// Only the jitter buffer's playout needs a tick; it is switched on while a device streams into it.
+	PrimaryComponentTick.bStartWithTickEnabled = false;
 }
 
 void USWIGyroInputReceiverComponent::BeginPlay()
 {
 	Super::BeginPlay();
 
-	LastImuRecvRealTime = FPlatformTime::Seconds();
-
 	if (UGameInstance* GI = GetWorld() ? GetWorld()->GetGameInstance() : nullptr)
 	{
 		Hub = GI->GetSubsystem<USWIHubClientSubsystem>();
@@ -26,22 +26,80 @@ void USWIGyroInputReceiverComponent::BeginPlay()
 		return;
 	}
 
-	Hub->OnImuFrame.AddUniqueDynamic(this, &ThisClass::HandleImu);
-	Hub->OnDeviceDisconnected.AddUniqueDynamic(this, &ThisClass::HandleDeviceDisconnected);
-
-	UE_LOG(LogTemp, Log, TEXT("[GYRO] Bound to Hub. Owner=%s"), *GetNameSafe(GetOwner()));
+	Hub->OnDeviceDisconnectedNative().Remove(DeviceDisconnectedHandle);
+	DeviceDisconnectedHandle = Hub->OnDeviceDisconnectedNative().AddUObject(this, &ThisClass::HandleDeviceDisconnected);
+	Hub->OnDeviceStaleNative().Remove(DeviceStaleHandle);
+	DeviceStaleHandle = Hub->OnDeviceStaleNative().AddUObject(this, &ThisClass::HandleDeviceStale);
+	BindToHub();
 }
 
 void USWIGyroInputReceiverComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	if (Hub)
 	{
-		Hub->OnImuFrame.RemoveDynamic(this, &ThisClass::HandleImu);
-		Hub->OnDeviceDisconnected.RemoveDynamic(this, &ThisClass::HandleDeviceDisconnected);
+		Hub->UnbindImu(this);
+		SetActiveDevice(INDEX_NONE);
+		Hub->OnDeviceDisconnectedNative().Remove(DeviceDisconnectedHandle);
+		Hub->OnDeviceStaleNative().Remove(DeviceStaleHandle);
+		DeviceDisconnectedHandle.Reset();
+		DeviceStaleHandle.Reset();
+		if (GyroLane != INDEX_NONE)
+		{
+			Hub->ReleaseGyroLane(GyroLane);
+			GyroLane = INDEX_NONE;
+		}
 	}
 	Super::EndPlay(EndPlayReason);
 }
 
+void USWIGyroInputReceiverComponent::SetDeviceUid(const FString& InUid)
+{
+	DeviceUid = InUid;
+	BindToHub();
+}
+
+void USWIGyroInputReceiverComponent::SetPlayerSlot(int32 InSlot)
+{
+	SetMatchSlot(FString(), InSlot);
+}
+
+void USWIGyroInputReceiverComponent::SetMatchSlot(const FString& InMatchId, int32 InSlot)
+{
+	PlayerMatchId = InSlot != INDEX_NONE ? InMatchId : FString();
+	PlayerSlot = InSlot;
+	BindToHub();
+}
+
+FString USWIGyroInputReceiverComponent::GetActiveDeviceUid() const
+{
+	return Hub ? Hub->GetDeviceUid(ActiveDevice) : FString();
+}
+
+void USWIGyroInputReceiverComponent::BindToHub()
+{
+	if (!Hub || !HasBegunPlay()) return;
+
+	Hub->UnbindImu(this);
+	SetActiveDevice(INDEX_NONE);
+
+	FSWIHubImuFrameNativeHandler Handler = FSWIHubImuFrameNativeHandler::CreateUObject(this, &ThisClass::HandleImu);
+
+	if (!DeviceUid.IsEmpty())
+	{
+		Hub->BindImuDeviceNative(DeviceUid, MoveTemp(Handler));
+	}
+	else if (PlayerSlot != INDEX_NONE)
+	{
+		Hub->BindImuMatchSlotNative(PlayerMatchId, PlayerSlot, MoveTemp(Handler));
+	}
+	else
+	{
+		Hub->BindImuNextDeviceNative(MoveTemp(Handler));
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[GYRO] Bound to Hub. Owner=%s Uid=%s Match=%s Slot=%d"), *GetNameSafe(GetOwner()), *DeviceUid, *PlayerMatchId, PlayerSlot);
+}
+
 bool USWIGyroInputReceiverComponent::GetIAValues(FVector2D& OutMove, FVector2D& OutLook) const
 {
 	if (!bConnected)
@@ -56,83 +114,279 @@ bool USWIGyroInputReceiverComponent::GetIAValues(FVector2D& OutMove, FVector2D&
 	return true;
 }
 
-float USWIGyroInputReceiverComponent::ExpSmoothingAlpha(float DeltaTime, float SmoothingHz)
+bool USWIGyroInputReceiverComponent::ConsumeIAValues(float DeltaTime, FVector2D& OutMove, FVector2D& OutLook)
 {
-	if (SmoothingHz <= 0.f) return 1.f;
-	return 1.f - FMath::Exp(-SmoothingHz * DeltaTime);
+	if (!bConnected)
+	{
+		OutMove = FVector2D::ZeroVector;
+		OutLook = FVector2D::ZeroVector;
+		return false;
+	}
+
+	CurrentLook = LookIntegrator.Consume(DeltaTime, LookSmoothingHz);
+
+	if (bPredictLook)
+	{
+		// Fixed horizon: clamp to it. Measured: network + release lag, plus the newest sample's age (added by the predictor).
+		const bool bFixedHorizon = LookPredictionHorizonMs > 0.f;
+		const float ReleaseLagSec = LookSmoothingHz > 0.f ? 1.f / LookSmoothingHz : 0.f;
+		const float HubLegMs = bAddMeasuredHubLatency && Hub ? Hub->GetHubRttMs() * 0.5f : 0.f;
+		const float LatencySec = bFixedHorizon ? LookPredictionHorizonMs * 0.001f : (NetworkLatencyMs + HubLegMs) * 0.001f + ReleaseLagSec;
+
+		LookPredictor.MaxHorizonSec = FMath::Min(MaxLookPredictionMs, bFixedHorizon ? LookPredictionHorizonMs : MaxLookPredictionMs) * 0.001f;
+		LookPredictor.MaxErrorDeg = MaxLookPredictionErrorDeg;
+
+		CurrentLook += LookPredictor.Consume(FPlatformTime::Seconds(), DeltaTime, LatencySec);
+	}
+
+	OutMove = CurrentMove;
+	OutLook = CurrentLook;
+	return true;
 }
 
-float USWIGyroInputReceiverComponent::ApplyDeadZone(float v, float deadZone)
+void USWIGyroInputReceiverComponent::NotifyInputApplied()
 {
-	const float a = FMath::Abs(v);
-	if (a <= deadZone) return 0.f;
-	const float sign = FMath::Sign(v);
-	const float t = (a - deadZone) / (1.f - deadZone);
-	return sign * FMath::Clamp(t, 0.f, 1.f);
+	if (!bHasUnappliedSample || !Hub) return;
+
+	bHasUnappliedSample = false;
+	Hub->RecordImuApplied(ActiveDevice, UnappliedTsMs, UnappliedDequeueSec);
 }
 
 void USWIGyroInputReceiverComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
 
+	if (!bConnected || !bUseJitterBuffer)
+	{
+		SetComponentTickEnabled(false);
+		return;
+	}
+
+	JitterBuffer.MinDelayMs = JitterMinDelayMs;
+	JitterBuffer.MaxDelayMs = JitterMaxDelayMs;
+	JitterBuffer.DelayPercentile = JitterDelayPercentile;
+	JitterBuffer.MaxExtrapolationMs = MaxExtrapolationMs;
+
 	const double Now = FPlatformTime::Seconds();
-	if (bConnected && (Now - LastImuRecvRealTime) > DisconnectTimeoutSec)
+	FSWIHubImuFrame Played;
+	const FSWIGyroJitterBuffer::EPlayout Result = JitterBuffer.Playout(Now, Played);
+	if (Result == FSWIGyroJitterBuffer::EPlayout::Interpolated || Result == FSWIGyroJitterBuffer::EPlayout::Extrapolated)
 	{
-		bConnected = false;
-		bHasNeutral = false;
-		bHasPrevAngles = false;
+		ProcessSample(Played, Now);
+	}
+}
+
+void USWIGyroInputReceiverComponent::ResetDeviceState()
+{
+	MoveState.bHasNeutral = false;
+	bHasPrevAngles = false;
+	LookIntegrator.Reset();
+	JitterBuffer.Reset();
+	Ahrs.Reset();
+	LookPredictor.Reset();
+	if (GyroLane != INDEX_NONE && Hub)
+	{
+		Hub->GetGyroBatch().ResetLane(GyroLane);
+	}
+
+	// 기기가 끊기거나 바뀌면 누르고 있던 버튼은 뗀 것으로 처리한다
+	SetHeldButtons(0, 0.0, FPlatformTime::Seconds());
+	LastSeq = 0;
+	LastButtonTsMs = 0.0;
+}
+
+float USWIGyroInputReceiverComponent::GetFireHoldSec() const
+{
+	return IsFireHeld() ? static_cast<float>(FPlatformTime::Seconds() - PressLocalSec[0]) : 0.f;
+}
 
-		CurrentMove = FVector2D::ZeroVector;
-		CurrentLook = FVector2D::ZeroVector;
+void USWIGyroInputReceiverComponent::ProcessButtons(const FSWIHubImuFrame& Frame, double Now)
+{
+	// Buttons are level state, so only the newest packet matters; older or repeated ones are dropped.
+	if (Frame.Seq > 0)
+	{
+		if (LastSeq > 0 && Frame.Seq <= LastSeq && LastSeq - Frame.Seq < SeqResetWindow)
+		{
+			return;
+		}
+		if (LastSeq > 0 && Frame.Seq > LastSeq + FMath::Max(Frame.NumSamples, 1))
+		{
+			++NumSeqGaps;
+			UE_LOG(LogTemp, Verbose, TEXT("[GYRO] seq gap %lld -> %lld"), LastSeq, Frame.Seq);
+		}
+		LastSeq = Frame.Seq;
+	}
+	else if (Frame.TsMs > 0.0)
+	{
+		// 구형 송신기: seq가 없으면 ts로 순서를 판단
+		if (Frame.TsMs <= LastButtonTsMs && LastButtonTsMs - Frame.TsMs < 1000.0)
+		{
+			return;
+		}
+	}
 
-		UE_LOG(LogTemp, Warning, TEXT("[GYRO] IMU timeout -> stop"));
-		ForceStopPawnNow();
+	if (Frame.TsMs > 0.0)
+	{
+		LastButtonTsMs = Frame.TsMs;
+	}
+	SetHeldButtons(Frame.Buttons, Frame.TsMs, Now);
+}
+
+void USWIGyroInputReceiverComponent::SetHeldButtons(int32 Buttons, double TsMs, double Now)
+{
+	const uint32 Released = static_cast<uint32>(HeldButtons) & ~static_cast<uint32>(Buttons);
+	const uint32 Pressed = static_cast<uint32>(Buttons) & ~static_cast<uint32>(HeldButtons);
+	if (!Released && !Pressed) return;
+
+	// State first: handlers may query it, or reset this component.
+	HeldButtons = Buttons;
+
+	float ReleasedHeldSec[MaxButtons] = {};
+	for (int32 Bit = 0; Bit < MaxButtons; ++Bit)
+	{
+		if (Released & (1u << Bit))
+		{
+			const bool bSenderClock = TsMs > 0.0 && PressTsMs[Bit] > 0.0 && TsMs >= PressTsMs[Bit];
+			ReleasedHeldSec[Bit] = static_cast<float>(bSenderClock ? (TsMs - PressTsMs[Bit]) * 0.001 : Now - PressLocalSec[Bit]);
+		}
+		else if (Pressed & (1u << Bit))
+		{
+			PressTsMs[Bit] = TsMs;
+			PressLocalSec[Bit] = Now;
+		}
+	}
+
+	for (int32 Bit = 0; Bit < MaxButtons; ++Bit)
+	{
+		if (Released & (1u << Bit))
+		{
+			OnButtonReleased.Broadcast(Bit, ReleasedHeldSec[Bit]);
+			if (Bit == 0)
+			{
+				OnSWIFireReleased.Broadcast(ReleasedHeldSec[Bit]);
+			}
+		}
+	}
+	for (int32 Bit = 0; Bit < MaxButtons; ++Bit)
+	{
+		if (Pressed & (1u << Bit))
+		{
+			OnButtonPressed.Broadcast(Bit);
+			if (Bit == 0)
+			{
+				OnSWIFire.Broadcast();
+			}
+		}
 	}
 }
 
 void USWIGyroInputReceiverComponent::HandleImu(const FSWIHubImuFrame& Frame)
 {
 	const double Now = FPlatformTime::Seconds();
-	LastImuRecvRealTime = Now;
 	bConnected = true;
 
-	const float Dt = GetWorld() ? GetWorld()->GetDeltaSeconds() : (1.f / 60.f);
+	if (ActiveDevice != Frame.Device)
+	{
+		// 슬롯 바인딩은 매치마다 다른 기기가 들어올 수 있다
+		SetActiveDevice(Frame.Device);
+		ResetDeviceState();
+	}
+
+	// 버튼은 지터 버퍼를 거치지 않는다: 누름/뗌은 도착 즉시 한 번씩
+	ProcessButtons(Frame, Now);
+
+	if (bUseJitterBuffer && Frame.TsMs > 0.0)
+	{
+		if (!IsComponentTickEnabled())
+		{
+			SetComponentTickEnabled(true);
+		}
+		// 틱에서 일정한 지연으로 재생한다 (ts 없는 송신기는 즉시 처리)
+		JitterBuffer.Push(Frame);
+		return;
+	}
+
+	ProcessSample(Frame, Now);
+}
+
+void USWIGyroInputReceiverComponent::ProcessSample(const FSWIHubImuFrame& Frame, double Now)
+{
+	// 렌더 프레임이 아니라 폰의 샘플 간격으로 적분한다 (중복/역순 패킷은 버림)
+	// A coalesced frame stands for NumSamples phone samples, so the per-sample limits scale with it.
+	const int32 NumSamples = FMath::Max(Frame.NumSamples, 1);
+	LookIntegrator.MaxSampleGapSec = MaxSampleGapSec * NumSamples;
+	const float Dt = LookIntegrator.AdvanceSample(Frame.TsMs, Frame.RecvTimeSec);
+	if (Dt < 0.f)
+	{
+		return;
+	}
 
-	// ---- MOVE: gravity tilt ----
 	const float ax = Frame.Ax;
 	const float ay = Frame.Ay;
 	const float az = Frame.Az;
 
-	const float RollDeg = FMath::RadiansToDegrees(FMath::Atan2(ax, az));
-	const float PitchDeg = FMath::RadiansToDegrees(FMath::Atan2(-ay, FMath::Sqrt(ax * ax + az * az)));
+	if (bUseSensorFusion)
+	{
+		// devicemotion body rates: Gx=alpha(z), Gy=beta(x), Gz=gamma(y)
+		Ahrs.Beta = FusionBeta;
 
-	if (!bHasNeutral)
+		// Sub-step a coalesced span at its mean rate so the filter sees sample-sized steps.
+		FusedLookStepDeg = FVector2f::ZeroVector;
+		const FVector3f BodyRate(Frame.Gy, Frame.Gz, Frame.Gx);
+		for (int32 Step = 0; Step < NumSamples; ++Step)
+		{
+			Ahrs.Update(BodyRate, FVector3f(ax, ay, az), Dt / NumSamples);
+			FusedLookStepDeg += Ahrs.GetLastYawPitchDeltaDeg();
+		}
+		if (!Ahrs.IsInitialized())
+		{
+			return;
+		}
+	}
+
+	const FVector2f RawLookDeg = ComputeRawLookDelta(Frame, Dt);
+	if (bBatchedMath && Hub)
 	{
-		NeutralRollDeg = RollDeg;
-		NeutralPitchDeg = PitchDeg;
-		bHasNeutral = true;
+		PushBatchedSample(Frame, Dt, NumSamples, RawLookDeg, Now);
+		return;
 	}
 
-	const float DeltaRoll = FMath::Clamp(FMath::FindDeltaAngleDegrees(NeutralRollDeg, RollDeg), -90.f, 90.f);
-	const float DeltaPitch = FMath::Clamp(FMath::FindDeltaAngleDegrees(NeutralPitchDeg, PitchDeg), -90.f, 90.f);
+	// Same kernel as the hub's batched pass.
+	const FVector2D LookDelta(FSWIGyroBatch::ProcessSample(MakeBatchParams(), MoveState, MakeBatchSample(Frame, Dt, NumSamples, RawLookDeg)));
 
-	float Forward = FMath::Clamp((DeltaPitch / MoveMaxTiltDeg) * MoveForwardSign, -1.f, 1.f);
-	float Right = FMath::Clamp((DeltaRoll / MoveMaxTiltDeg) * MoveRightSign, -1.f, 1.f);
+	// Smoothing happens on release in ConsumeIAValues, so the total stays exact.
+	LookIntegrator.AddDelta(LookDelta);
+	LookPredictor.AddSample(LookDelta, Dt, Frame.RecvTimeSec > 0.0 ? Frame.RecvTimeSec : Now);
 
-	Forward = ApplyDeadZone(Forward, MoveDeadZone);
-	Right = ApplyDeadZone(Right, MoveDeadZone);
+	CurrentMove = FVector2D(MoveState.Move);
 
-	const float MoveA = ExpSmoothingAlpha(Dt, MoveSmoothingHz);
-	SmoothedMove = FMath::Lerp(SmoothedMove, FVector2D(Forward, Right), MoveA);
+	bHasUnappliedSample = true;
+	UnappliedTsMs = Frame.TsMs;
+	UnappliedDequeueSec = Frame.DequeueTimeSec;
+
+	static double LastPrint = 0.0;
+	if ((Now - LastPrint) > 0.5)
+	{
+		LastPrint = Now;
+		UE_LOG(LogTemp, Log, TEXT("[GYRO] Move(%.2f,%.2f) Look(%.2f,%.2f) ax=%.2f ay=%.2f az=%.2f gz=%.2f gy=%.2f"),
+			CurrentMove.X, CurrentMove.Y, CurrentLook.X, CurrentLook.Y, ax, ay, az, Frame.Gz, Frame.Gy);
+	}
+}
 
-	// ---- LOOK ----
-	float RawYawDeltaDeg = 0.f;
-	float RawPitchDeltaDeg = 0.f;
+FVector2f USWIGyroInputReceiverComponent::ComputeRawLookDelta(const FSWIHubImuFrame& Frame, float Dt)
+{
+	FVector2f OutDeg = FVector2f::ZeroVector;
 
-	if (bPreferGyroRate)
+	if (bUseSensorFusion)
 	{
-		RawYawDeltaDeg = Frame.Gz * Dt;
-		RawPitchDeltaDeg = Frame.Gy * Dt;
+		// Bias-corrected rate rotated into the world: yaw about gravity, pitch about the horizontal right axis.
+		OutDeg.X = FusedLookStepDeg.X;
+		OutDeg.Y = FusedLookStepDeg.Y;
+	}
+	else if (bPreferGyroRate)
+	{
+		OutDeg.X = Frame.Gz * Dt;
+		OutDeg.Y = Frame.Gy * Dt;
 	}
 	else
 	{
@@ -146,56 +400,122 @@ void USWIGyroInputReceiverComponent::HandleImu(const FSWIHubImuFrame& Frame)
 			bHasPrevAngles = true;
 		}
 
-		RawYawDeltaDeg = FMath::FindDeltaAngleDegrees(PrevYawDeg, CurrYaw);
-		RawPitchDeltaDeg = FMath::FindDeltaAngleDegrees(PrevPitchDeg, CurrPitch);
+		OutDeg.X = FMath::FindDeltaAngleDegrees(PrevYawDeg, CurrYaw);
+		OutDeg.Y = FMath::FindDeltaAngleDegrees(PrevPitchDeg, CurrPitch);
 
 		PrevYawDeg = CurrYaw;
 		PrevPitchDeg = CurrPitch;
 	}
 
-	if (bInvertLookPitch) RawPitchDeltaDeg *= -1.f;
-
-	RawYawDeltaDeg = FMath::Clamp(RawYawDeltaDeg, -MaxLookDeltaPerFrame, MaxLookDeltaPerFrame);
-	RawPitchDeltaDeg = FMath::Clamp(RawPitchDeltaDeg, -MaxLookDeltaPerFrame, MaxLookDeltaPerFrame);
+	return OutDeg;
+}
 
-	const float LookA = ExpSmoothingAlpha(Dt, LookSmoothingHz);
-	SmoothedLook = FMath::Lerp(
-		SmoothedLook,
-		FVector2D(RawYawDeltaDeg * LookYawScale, RawPitchDeltaDeg * LookPitchScale),
-		LookA
-	);
+FSWIGyroBatchParams USWIGyroInputReceiverComponent::MakeBatchParams() const
+{
+	FSWIGyroBatchParams Params;
+	Params.MoveMaxTiltDeg = MoveMaxTiltDeg;
+	Params.MoveForwardSign = MoveForwardSign;
+	Params.MoveRightSign = MoveRightSign;
+	Params.MoveDeadZone = MoveDeadZone;
+	Params.MoveSmoothingHz = MoveSmoothingHz;
+	Params.LookYawScale = LookYawScale;
+	Params.LookPitchScale = LookPitchScale;
+	Params.bInvertLookPitch = bInvertLookPitch;
+	Params.bFusedTilt = bUseSensorFusion;
+	return Params;
+}
 
-	CurrentMove = SmoothedMove;
-	CurrentLook = SmoothedLook;
+FSWIGyroBatchSample USWIGyroInputReceiverComponent::MakeBatchSample(const FSWIHubImuFrame& Frame, float Dt, int32 NumSamples, const FVector2f& RawLookDeg) const
+{
+	// A coalesced frame stands for NumSamples phone samples, so the per-sample look clamp scales with it.
+	FSWIGyroBatchSample Sample;
+	Sample.Dt = Dt;
+	Sample.Tilt = bUseSensorFusion ? Ahrs.GetUpInBody() : FVector3f(Frame.Ax, Frame.Ay, Frame.Az);
+	Sample.RawLookDeg = RawLookDeg;
+	Sample.MaxLookDeltaDeg = MaxLookDeltaPerFrame * NumSamples;
+	return Sample;
+}
 
-	const bool bFire = Frame.Fire ? true : false;
-	if(bFire)
+void USWIGyroInputReceiverComponent::PushBatchedSample(const FSWIHubImuFrame& Frame, float Dt, int32 NumSamples, const FVector2f& RawLookDeg, double Now)
+{
+	FSWIGyroBatch& Batch = Hub->GetGyroBatch();
+	if (GyroLane == INDEX_NONE)
 	{
-		OnSWIFire.Broadcast();
+		GyroLane = Hub->AcquireGyroLane(this);
+		Batch.SetSmoothedMove(GyroLane, MoveState.Move);
 	}
 
-	static double LastPrint = 0.0;
-	if ((Now - LastPrint) > 0.5)
+	Batch.SetParams(GyroLane, MakeBatchParams());
+
+	const FSWIGyroBatchSample Sample = MakeBatchSample(Frame, Dt, NumSamples, RawLookDeg);
+	if (!Batch.Push(GyroLane, Sample))
 	{
-		LastPrint = Now;
-		UE_LOG(LogTemp, Log, TEXT("[GYRO] Move(%.2f,%.2f) Look(%.2f,%.2f) ax=%.2f ay=%.2f az=%.2f gz=%.2f gy=%.2f"),
-			CurrentMove.X, CurrentMove.Y, CurrentLook.X, CurrentLook.Y, ax, ay, az, Frame.Gz, Frame.Gy);
+		// More samples than one pass holds (a hitch with coalescing off): run the pass early.
+		Hub->FlushGyroBatch();
+		Batch.Push(GyroLane, Sample);
 	}
+
+	BatchedTsMs = Frame.TsMs;
+	BatchedDequeueSec = Frame.DequeueTimeSec;
+	BatchedRecvSec = Frame.RecvTimeSec > 0.0 ? Frame.RecvTimeSec : Now;
+}
+
+void USWIGyroInputReceiverComponent::ApplyBatchedResult(const FSWIGyroBatchResult& Result)
+{
+	MoveState.Move = Result.Move;
+	CurrentMove = FVector2D(MoveState.Move);
+
+	// The pass's samples reach the integrator and predictor as one span, like a coalesced frame.
+	const FVector2D LookDelta(Result.LookDeltaDeg);
+	LookIntegrator.AddDelta(LookDelta);
+	LookPredictor.AddSample(LookDelta, Result.Dt, BatchedRecvSec);
+
+	bHasUnappliedSample = true;
+	UnappliedTsMs = BatchedTsMs;
+	UnappliedDequeueSec = BatchedDequeueSec;
 }
 
 void USWIGyroInputReceiverComponent::HandleDeviceDisconnected(const FSWIHubDeviceInfo& Info)
+{
+	if (!Hub || ActiveDevice == INDEX_NONE || Hub->GetDeviceHandle(Info.Uid) != ActiveDevice) return;
+
+	DropDevice(TEXT("device_disconnected"));
+}
+
+void USWIGyroInputReceiverComponent::HandleDeviceStale(int32 Device)
+{
+	if (!bConnected || Device != ActiveDevice) return;
+
+	DropDevice(TEXT("IMU timeout"));
+}
+
+void USWIGyroInputReceiverComponent::DropDevice(const TCHAR* Reason)
 {
 	bConnected = false;
-	bHasNeutral = false;
-	bHasPrevAngles = false;
+	ResetDeviceState();
 
 	CurrentMove = FVector2D::ZeroVector;
 	CurrentLook = FVector2D::ZeroVector;
 
-	UE_LOG(LogTemp, Warning, TEXT("[GYRO] device_disconnected -> stop"));
+	UE_LOG(LogTemp, Warning, TEXT("[GYRO] %s -> stop"), Reason);
 	ForceStopPawnNow();
 }
 
+void USWIGyroInputReceiverComponent::SetActiveDevice(int32 Device)
+{
+	if (Hub && ActiveDevice != INDEX_NONE)
+	{
+		Hub->UnwatchDevice(ActiveDevice);
+	}
+
+	ActiveDevice = Device;
+
+	if (Hub && ActiveDevice != INDEX_NONE)
+	{
+		Hub->WatchDevice(ActiveDevice, DisconnectTimeoutSec);
+	}
+}
+
 void USWIGyroInputReceiverComponent::ForceStopPawnNow()
 {
 	APawn* Pawn = nullptr;
@@ -3,9 +3,17 @@
 #include "CoreMinimal.h"
 #include "Components/ActorComponent.h"
 #include "SWI/Subsystems/SWIHubServiceSubsystem.h"
+#include "SWI/Gyro/SWIGyroLookIntegrator.h"
+#include "SWI/Gyro/SWIGyroJitterBuffer.h"
+#include "SWI/Gyro/SWIGyroAhrs.h"
+#include "SWI/Gyro/SWIGyroLookPredictor.h"
+#include "SWI/Gyro/SWIGyroBatch.h"
 #include "SWIGyroInputReceiverComponent.generated.h"
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FOnSWIFire);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSWIFireReleased, float, HeldSec);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnSWIButtonPressed, int32, Button);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnSWIButtonReleased, int32, Button, float, HeldSec);
 
 UCLASS(ClassGroup = (Custom), meta = (BlueprintSpawnableComponent))
 class SWI_API USWIGyroInputReceiverComponent : public UActorComponent
@@ -21,6 +29,45 @@ public:
 
 	bool GetIAValues(FVector2D& OutMove, FVector2D& OutLook) const;
 
+	// Per-tick consumer: returns the move axis and releases the look rotation accumulated from samples.
+	bool ConsumeIAValues(float DeltaTime, FVector2D& OutMove, FVector2D& OutLook);
+
+	// Called by the consumer right after it applied the values (latency tracing).
+	void NotifyInputApplied();
+
+	// Hub, after the batched pass that processed this receiver's samples.
+	void ApplyBatchedResult(const FSWIGyroBatchResult& Result);
+
+	UFUNCTION(BlueprintCallable, Category = "Gyro|Device")
+	void SetDeviceUid(const FString& InUid);
+
+	// Slot in the newest match.
+	UFUNCTION(BlueprintCallable, Category = "Gyro|Device")
+	void SetPlayerSlot(int32 InSlot);
+
+	UFUNCTION(BlueprintCallable, Category = "Gyro|Device")
+	void SetMatchSlot(const FString& InMatchId, int32 InSlot);
+
+	UFUNCTION(BlueprintPure, Category = "Gyro|Device")
+	FString GetActiveDeviceUid() const;
+
+	// Hub device handle of the phone currently driving this receiver (INDEX_NONE = none yet).
+	UFUNCTION(BlueprintPure, Category = "Gyro|Device")
+	int32 GetActiveDevice() const { return ActiveDevice; }
+
+	// Phone that drives this receiver. Empty uid and no slot = first phone the hub has no route for.
+	UPROPERTY(EditAnywhere, Category = "Gyro|Device")
+	FString DeviceUid;
+
+	// Player index from match_start; used when DeviceUid is empty.
+	UPROPERTY(EditAnywhere, Category = "Gyro|Device")
+	int32 PlayerSlot = INDEX_NONE;
+
+	// Match that PlayerSlot indexes. Empty = newest match.
+	UPROPERTY(VisibleAnywhere, Category = "Gyro|Device")
+	FString PlayerMatchId;
+
+	// No IMU for this long stops the pawn. Checked by the hub's device watchdog, so the component does not tick for it.
 	UPROPERTY(EditAnywhere, Category = "Gyro|Device")
 	float DisconnectTimeoutSec = 0.25f;
 
@@ -39,9 +86,28 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Gyro|Move")
 	float MoveForwardSign = 1.0f;
 
-	UPROPERTY(EditAnywhere, Category = "Gyro|Look")
+	// Fuse accel + gyro into a quaternion (Madgwick) and derive move tilt and look from it.
+	// Off = legacy per-packet Atan2 tilt and raw gyro / Euler differencing.
+	UPROPERTY(EditAnywhere, Category = "Gyro|Fusion")
+	bool bUseSensorFusion = true;
+
+	UPROPERTY(EditAnywhere, Category = "Gyro|Fusion", meta = (EditCondition = "bUseSensorFusion", ClampMin = "0"))
+	float FusionBeta = 0.08f;
+
+	UFUNCTION(BlueprintPure, Category = "Gyro|Fusion")
+	FRotator GetFusedOrientation() const { return FRotator(FQuat(Ahrs.GetOrientation())); }
+
+	UFUNCTION(BlueprintPure, Category = "Gyro|Fusion")
+	FVector GetGyroBiasDegPerSec() const { return FVector(Ahrs.GetGyroBias()); }
+
+	UPROPERTY(EditAnywhere, Category = "Gyro|Look", meta = (EditCondition = "!bUseSensorFusion"))
 	bool bPreferGyroRate = true;
 
+	// Large venues: move / look math runs in the hub's per-tick SIMD pass shared by every batched receiver.
+	// Same results; they land when the hub drains instead of per packet.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gyro|Batch")
+	bool bBatchedMath = false;
+
 	UPROPERTY(EditAnywhere, Category = "Gyro|Look")
 	float LookYawScale = 1.8f;
 
@@ -54,12 +120,102 @@ public:
 	UPROPERTY(EditAnywhere, Category = "Gyro|Look")
 	float LookSmoothingHz = 18.0f;
 
+	// Per IMU sample (deg), before scaling.
 	UPROPERTY(EditAnywhere, Category = "Gyro|Look")
 	float MaxLookDeltaPerFrame = 8.0f;
 
+	// Longest sender interval one sample may integrate over.
+	UPROPERTY(EditAnywhere, Category = "Gyro|Look")
+	float MaxSampleGapSec = 0.1f;
+
+	// Leads look by the measured pipeline latency (constant-rate Kalman forecast) to hide network + smoothing lag.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gyro|Prediction")
+	bool bPredictLook = false;
+
+	// 0 = measured: sample age + NetworkLatencyMs + release lag (1 / LookSmoothingHz).
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gyro|Prediction", meta = (EditCondition = "bPredictLook", ClampMin = "0"))
+	float LookPredictionHorizonMs = 0.f;
+
+	// One-way phone -> hub estimate added to the measured part of the horizon (also covers hub -> game when the measured leg is off).
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gyro|Prediction", meta = (EditCondition = "bPredictLook", ClampMin = "0"))
+	float NetworkLatencyMs = 25.f;
+
+	// Adds half the hub's heartbeat RTT (hub -> game leg, measured live) to NetworkLatencyMs.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gyro|Prediction", meta = (EditCondition = "bPredictLook"))
+	bool bAddMeasuredHubLatency = true;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gyro|Prediction", meta = (EditCondition = "bPredictLook", ClampMin = "0"))
+	float MaxLookPredictionMs = 100.f;
+
+	// Running forecast error (deg, after scaling) above which the lead is scaled down.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gyro|Prediction", meta = (EditCondition = "bPredictLook", ClampMin = "0"))
+	float MaxLookPredictionErrorDeg = 3.f;
+
+	UFUNCTION(BlueprintPure, Category = "Gyro|Prediction")
+	FVector2D GetLookPredictionLead() const { return LookPredictor.GetLead(); }
+
+	UFUNCTION(BlueprintPure, Category = "Gyro|Prediction")
+	float GetLookPredictionErrorDeg() const { return LookPredictor.GetErrorDeg(); }
+
+	// Plays samples out at a steady, adaptive delay instead of as they arrive (smoother, adds latency).
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gyro|Jitter")
+	bool bUseJitterBuffer = false;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gyro|Jitter", meta = (EditCondition = "bUseJitterBuffer", ClampMin = "0"))
+	float JitterMinDelayMs = 10.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gyro|Jitter", meta = (EditCondition = "bUseJitterBuffer", ClampMin = "0"))
+	float JitterMaxDelayMs = 150.f;
+
+	// Share of packets that must arrive before their playout time.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gyro|Jitter", meta = (EditCondition = "bUseJitterBuffer", ClampMin = "0.5", ClampMax = "1.0"))
+	float JitterDelayPercentile = 0.95f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Gyro|Jitter", meta = (EditCondition = "bUseJitterBuffer", ClampMin = "0"))
+	float MaxExtrapolationMs = 50.f;
+
+	UFUNCTION(BlueprintPure, Category = "Gyro|Jitter")
+	float GetJitterMs() const { return JitterBuffer.GetJitterMs(); }
+
+	UFUNCTION(BlueprintPure, Category = "Gyro|Jitter")
+	float GetJitterTargetDelayMs() const { return JitterBuffer.GetTargetDelayMs(); }
+
+	UFUNCTION(BlueprintPure, Category = "Gyro|Jitter")
+	double GetClockOffsetMs() const { return JitterBuffer.GetClockOffsetMs(FPlatformTime::Seconds()); }
+
+	UFUNCTION(BlueprintPure, Category = "Gyro|Jitter")
+	double GetClockDriftPpm() const { return JitterBuffer.GetClockDriftPpm(); }
+
+	// Edge events from the phone's button bitmask: once per press / release, never per packet.
+	// Handled on arrival (ahead of the jitter buffer), de-duplicated by Seq.
 	UPROPERTY(BlueprintAssignable, Category = "Gyro|Fire")
 	FOnSWIFire OnSWIFire;
 
+	// Hold time is measured on the phone's clock when it stamps ts.
+	UPROPERTY(BlueprintAssignable, Category = "Gyro|Fire")
+	FOnSWIFireReleased OnSWIFireReleased;
+
+	// Button = bit index in the bitmask (0 = fire).
+	UPROPERTY(BlueprintAssignable, Category = "Gyro|Buttons")
+	FOnSWIButtonPressed OnButtonPressed;
+
+	UPROPERTY(BlueprintAssignable, Category = "Gyro|Buttons")
+	FOnSWIButtonReleased OnButtonReleased;
+
+	UFUNCTION(BlueprintPure, Category = "Gyro|Buttons")
+	bool IsButtonHeld(int32 Button) const { return Button >= 0 && Button < MaxButtons && ((static_cast<uint32>(HeldButtons) >> Button) & 1u) != 0; }
+
+	UFUNCTION(BlueprintPure, Category = "Gyro|Fire")
+	bool IsFireHeld() const { return IsButtonHeld(0); }
+
+	// Seconds since fire was pressed (local clock), 0 when not held.
+	UFUNCTION(BlueprintPure, Category = "Gyro|Fire")
+	float GetFireHoldSec() const;
+
+	// Jumps in the phone's packet sequence (packets lost before they reached this receiver).
+	UFUNCTION(BlueprintPure, Category = "Gyro|Buttons")
+	int32 GetNumSequenceGaps() const { return NumSeqGaps; }
+
 private:
 	UPROPERTY()
 	TObjectPtr<USWIHubClientSubsystem> Hub = nullptr;
@@ -67,28 +223,66 @@ private:
 	FVector2D CurrentMove = FVector2D::ZeroVector;
 	FVector2D CurrentLook = FVector2D::ZeroVector;
 
-	FVector2D SmoothedMove = FVector2D::ZeroVector;
-	FVector2D SmoothedLook = FVector2D::ZeroVector;
+	int32 ActiveDevice = INDEX_NONE;
 
-	double LastImuRecvRealTime = 0.0;
 	bool bConnected = false;
 
-	bool bHasNeutral = false;
-	float NeutralPitchDeg = 0.f;
-	float NeutralRollDeg = 0.f;
+	// Neutral pose and smoothed move (unbatched; the hub's lane holds them when batched).
+	FSWIGyroLaneState MoveState;
+	FVector2f FusedLookStepDeg = FVector2f::ZeroVector;
 
 	bool bHasPrevAngles = false;
 	float PrevYawDeg = 0.f;
 	float PrevPitchDeg = 0.f;
 
-	UFUNCTION()
+	FSWIGyroLookIntegrator LookIntegrator;
+	FSWIGyroJitterBuffer JitterBuffer;
+	FSWIGyroAhrs Ahrs;
+	FSWIGyroLookPredictor LookPredictor;
+
+	static constexpr int32 MaxButtons = 32;
+
+	// A sequence number this far behind the last one means the phone restarted its counter.
+	static constexpr int64 SeqResetWindow = 1000;
+
+	int32 HeldButtons = 0;
+	int64 LastSeq = 0;
+	double LastButtonTsMs = 0.0;
+	int32 NumSeqGaps = 0;
+	double PressTsMs[MaxButtons] = {};
+	double PressLocalSec[MaxButtons] = {};
+
+	// bBatchedMath: lane in the hub's FSWIGyroBatch, and the newest sample pushed to it.
+	int32 GyroLane = INDEX_NONE;
+	double BatchedTsMs = 0.0;
+	double BatchedDequeueSec = 0.0;
+	double BatchedRecvSec = 0.0;
+
+	// Newest processed sample not yet reported as applied.
+	bool bHasUnappliedSample = false;
+	double UnappliedTsMs = 0.0;
+	double UnappliedDequeueSec = 0.0;
+
+	// Native hub bindings (no reflection per frame).
 	void HandleImu(const FSWIHubImuFrame& Frame);
 
-	UFUNCTION()
+	void ProcessSample(const FSWIHubImuFrame& Frame, double Now);
+	FVector2f ComputeRawLookDelta(const FSWIHubImuFrame& Frame, float Dt);
+	FSWIGyroBatchParams MakeBatchParams() const;
+	FSWIGyroBatchSample MakeBatchSample(const FSWIHubImuFrame& Frame, float Dt, int32 NumSamples, const FVector2f& RawLookDeg) const;
+	void PushBatchedSample(const FSWIHubImuFrame& Frame, float Dt, int32 NumSamples, const FVector2f& RawLookDeg, double Now);
+	void ProcessButtons(const FSWIHubImuFrame& Frame, double Now);
+	void SetHeldButtons(int32 Buttons, double TsMs, double Now);
+	void ResetDeviceState();
+
 	void HandleDeviceDisconnected(const FSWIHubDeviceInfo& Info);
+	void HandleDeviceStale(int32 Device);
+	void DropDevice(const TCHAR* Reason);
+	void SetActiveDevice(int32 Device);
+	FDelegateHandle DeviceDisconnectedHandle;
+	FDelegateHandle DeviceStaleHandle;
 
+	void BindToHub();
 	void ForceStopPawnNow();
 
-	static float ExpSmoothingAlpha(float DeltaTime, float SmoothingHz);
-	static float ApplyDeadZone(float v, float deadZone);
 };
@@ -0,0 +1,80 @@
+#include "SWIAbilitySystemComponent.h"
+
+void USWIAbilitySystemComponent::AbilityInputTagPressed(const FGameplayTag& InputTag)
+{
+	if (!InputTag.IsValid()) return;
+
+	if (PressedInputTags.Contains(InputTag))
+	{
+		++NumCoalescedPresses;
+		return;
+	}
+	PressedInputTags.Add(InputTag);
+}
+
+void USWIAbilitySystemComponent::AbilityInputTagReleased(const FGameplayTag& InputTag)
+{
+	if (!InputTag.IsValid()) return;
+	ReleasedInputTags.AddUnique(InputTag);
+}
+
+void USWIAbilitySystemComponent::FindSpecsWithInputTag(const FGameplayTag& InputTag, TArray<FGameplayAbilitySpecHandle>& OutHandles) const
+{
+	for (const FGameplayAbilitySpec& Spec : ActivatableAbilities.Items)
+	{
+		if (Spec.Ability && Spec.GetDynamicSpecSourceTags().HasTagExact(InputTag))
+		{
+			OutHandles.Add(Spec.Handle);
+		}
+	}
+}
+
+void USWIAbilitySystemComponent::ProcessAbilityInput()
+{
+	if (PressedInputTags.Num() == 0 && ReleasedInputTags.Num() == 0) return;
+
+	// Handles first: activating can add or remove specs.
+	ScratchHandles.Reset();
+	for (const FGameplayTag& Tag : PressedInputTags)
+	{
+		FindSpecsWithInputTag(Tag, ScratchHandles);
+	}
+
+	for (const FGameplayAbilitySpecHandle& Handle : ScratchHandles)
+	{
+		FGameplayAbilitySpec* Spec = FindAbilitySpecFromHandle(Handle);
+		if (!Spec) continue;
+
+		Spec->InputPressed = true;
+		if (Spec->IsActive())
+		{
+			AbilitySpecInputPressed(*Spec);
+			continue;
+		}
+
+		// Activate, commit and end inside one scope go to the server as one batched RPC.
+		FScopedServerAbilityRPCBatcher Batch(this, Handle);
+		TryActivateAbility(Handle);
+	}
+
+	ScratchHandles.Reset();
+	for (const FGameplayTag& Tag : ReleasedInputTags)
+	{
+		FindSpecsWithInputTag(Tag, ScratchHandles);
+	}
+
+	for (const FGameplayAbilitySpecHandle& Handle : ScratchHandles)
+	{
+		if (FGameplayAbilitySpec* Spec = FindAbilitySpecFromHandle(Handle))
+		{
+			Spec->InputPressed = false;
+			if (Spec->IsActive())
+			{
+				AbilitySpecInputReleased(*Spec);
+			}
+		}
+	}
+
+	PressedInputTags.Reset();
+	ReleasedInputTags.Reset();
+}
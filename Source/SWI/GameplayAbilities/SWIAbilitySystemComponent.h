@@ -0,0 +1,38 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AbilitySystemComponent.h"
+#include "SWIAbilitySystemComponent.generated.h"
+
+/**
+ * Activates abilities by input tag (USWIGameplayAbility::InputTag) once per frame.
+ *
+ * Phone button edges arrive per packet, at any point in the frame; AbilityInputTagPressed / Released only record
+ * them, and the owning controller calls ProcessAbilityInput once per frame. However many presses of a tag came in,
+ * the frame makes one activation, and server ability RPCs are batched, so a predicted activation that commits and
+ * ends in the same frame (USWIGameplayAbility_Fire) reaches the server as a single RPC.
+ */
+UCLASS()
+class SWI_API USWIAbilitySystemComponent : public UAbilitySystemComponent
+{
+	GENERATED_BODY()
+
+public:
+	void AbilityInputTagPressed(const FGameplayTag& InputTag);
+	void AbilityInputTagReleased(const FGameplayTag& InputTag);
+
+	void ProcessAbilityInput();
+
+	// Presses folded into an activation made for an earlier press in the same frame.
+	int64 GetNumCoalescedPresses() const { return NumCoalescedPresses; }
+
+	virtual bool ShouldDoServerAbilityRPCBatch() const override { return true; }
+
+private:
+	void FindSpecsWithInputTag(const FGameplayTag& InputTag, TArray<FGameplayAbilitySpecHandle>& OutHandles) const;
+
+	TArray<FGameplayTag> PressedInputTags;
+	TArray<FGameplayTag> ReleasedInputTags;
+	TArray<FGameplayAbilitySpecHandle> ScratchHandles;
+	int64 NumCoalescedPresses = 0;
+};
@@ -1,2 +1,7 @@
 #include "SWIGameplayAbility.h"
 
+USWIGameplayAbility::USWIGameplayAbility()
+{
+	InstancingPolicy = EGameplayAbilityInstancingPolicy::InstancedPerActor;
+	NetExecutionPolicy = EGameplayAbilityNetExecutionPolicy::LocalPredicted;
+}
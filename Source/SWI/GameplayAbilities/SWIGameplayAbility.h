@@ -4,14 +4,22 @@
 
 #include "CoreMinimal.h"
 #include "Abilities/GameplayAbility.h"
+#include "GameplayTagContainer.h"
 #include "SWIGameplayAbility.generated.h"
 
 /**
- * 
+ * Base for SWI abilities: locally predicted, one instance per actor, and activated by input tag.
+ * ASWICharacter adds InputTag to the spec it grants, and USWIAbilitySystemComponent activates specs by that tag.
  */
 UCLASS()
 class SWI_API USWIGameplayAbility : public UGameplayAbility
 {
 	GENERATED_BODY()
-	
+
+public:
+	USWIGameplayAbility();
+
+	// e.g. Input.Gyro.Fire. Empty = not bound to input (activated by code or events).
+	UPROPERTY(EditDefaultsOnly, Category = "Input")
+	FGameplayTag InputTag;
 };
@@ -0,0 +1,52 @@
+#include "SWIGameplayAbility_Fire.h"
+#include "SWIGameplayTags.h"
+#include "SWI/SubSystems/SWIFireTraceSubsystem.h"
+#include "AbilitySystemComponent.h"
+#include "GameplayEffect.h"
+#include "Engine/World.h"
+
+USWIGameplayAbility_Fire::USWIGameplayAbility_Fire()
+{
+	InputTag = SWIGameplayTags::Input_Gyro_Fire;
+}
+
+void USWIGameplayAbility_Fire::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo,
+	const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData)
+{
+	if (!CommitAbility(Handle, ActorInfo, ActivationInfo))
+	{
+		EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
+		return;
+	}
+
+	AActor* Avatar = ActorInfo ? ActorInfo->AvatarActor.Get() : nullptr;
+	if (!Avatar)
+	{
+		EndAbility(Handle, ActorInfo, ActivationInfo, true, true);
+		return;
+	}
+
+	// Eyes and control rotation: the server has both from the client's moves, so both sides trace the same ray.
+	FVector Start;
+	FRotator Aim;
+	Avatar->GetActorEyesViewPoint(Start, Aim);
+	const FVector End = Start + Aim.Vector() * Range;
+
+	if (HasAuthority(&ActivationInfo))
+	{
+		if (USWIFireTraceSubsystem* Traces = Avatar->GetWorld()->GetSubsystem<USWIFireTraceSubsystem>())
+		{
+			FSWIFireShot Shot;
+			Shot.Shooter = Avatar;
+			Shot.Source = ActorInfo->AbilitySystemComponent;
+			Shot.Damage = DamageEffect ? MakeOutgoingGameplayEffectSpec(DamageEffect, GetAbilityLevel()) : FGameplayEffectSpecHandle();
+			Shot.Start = Start;
+			Shot.End = End;
+			Shot.Channel = TraceChannel;
+			Traces->QueueShot(MoveTemp(Shot));
+		}
+	}
+
+	OnFired(Start, End);
+	EndAbility(Handle, ActorInfo, ActivationInfo, true, false);
+}
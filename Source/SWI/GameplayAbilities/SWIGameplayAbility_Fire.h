@@ -0,0 +1,41 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SWIGameplayAbility.h"
+#include "SWIGameplayAbility_Fire.generated.h"
+
+class UGameplayEffect;
+
+/**
+ * Gyro fire: one hitscan shot from the avatar's eyes along its control rotation.
+ *
+ * Predicted on the owning client: cost and cooldown commit immediately and OnFired plays cosmetics without waiting
+ * for the server. The server traces the same ray through USWIFireTraceSubsystem and applies DamageEffect to what it
+ * hits. The ability ends in the frame it activates, so activation and end share one batched server RPC.
+ */
+UCLASS()
+class SWI_API USWIGameplayAbility_Fire : public USWIGameplayAbility
+{
+	GENERATED_BODY()
+
+public:
+	USWIGameplayAbility_Fire();
+
+	virtual void ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo,
+		const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData) override;
+
+protected:
+	UPROPERTY(EditDefaultsOnly, Category = "Fire")
+	float Range = 10000.f;
+
+	UPROPERTY(EditDefaultsOnly, Category = "Fire")
+	TEnumAsByte<ECollisionChannel> TraceChannel = ECC_Visibility;
+
+	// Applied to the hit actor's ability system at the ability's level.
+	UPROPERTY(EditDefaultsOnly, Category = "Fire")
+	TSubclassOf<UGameplayEffect> DamageEffect;
+
+	// Muzzle flash, sound, tracer. Runs on the predicting client and on the server.
+	UFUNCTION(BlueprintImplementableEvent, Category = "Fire")
+	void OnFired(const FVector& Start, const FVector& End);
+};
@@ -0,0 +1,6 @@
+#include "SWIGameplayTags.h"
+
+namespace SWIGameplayTags
+{
+	UE_DEFINE_GAMEPLAY_TAG_COMMENT(Input_Gyro_Fire, "Input.Gyro.Fire", "Phone fire button (bit 0).");
+}
@@ -0,0 +1,9 @@
+#pragma once
+
+#include "NativeGameplayTags.h"
+
+namespace SWIGameplayTags
+{
+	// Ability input tags: an ability whose InputTag matches is activated by that input.
+	SWI_API UE_DECLARE_GAMEPLAY_TAG_EXTERN(Input_Gyro_Fire);
+}
@@ -0,0 +1,118 @@
+#include "SWIGyroAhrs.h"
+
+void FSWIGyroAhrs::Update(const FVector3f& GyroDegPerSec, const FVector3f& Accel, float Dt)
+{
+	const float AccelNorm = Accel.Size();
+	LastYawPitchDeltaDeg = FVector2f::ZeroVector;
+
+	if (!bInitialized)
+	{
+		if (AccelNorm <= KINDA_SMALL_NUMBER) return;
+
+		// Start level with the measured gravity (heading 0) so the filter does not spend seconds converging.
+		Q = FQuat4f::FindBetweenNormals(Accel / AccelNorm, FVector3f::UnitZ());
+		GravityNorm = AccelNorm;
+		Bias = FVector3f::ZeroVector;
+		StillSec = 0.f;
+		SinceInitSec = 0.f;
+		bInitialized = true;
+		return;
+	}
+
+	if (Dt <= 0.f) return;
+
+	UpdateBias(GyroDegPerSec, AccelNorm, Dt);
+	SinceInitSec += Dt;
+
+	const FVector3f RateDeg = GyroDegPerSec - Bias;
+	const FVector3f Rate = RateDeg * (UE_PI / 180.f);
+
+	float q0 = Q.W, q1 = Q.X, q2 = Q.Y, q3 = Q.Z;
+
+	// Rate of change of quaternion from gyroscope
+	float qDot1 = 0.5f * (-q1 * Rate.X - q2 * Rate.Y - q3 * Rate.Z);
+	float qDot2 = 0.5f * (q0 * Rate.X + q2 * Rate.Z - q3 * Rate.Y);
+	float qDot3 = 0.5f * (q0 * Rate.Y - q1 * Rate.Z + q3 * Rate.X);
+	float qDot4 = 0.5f * (q0 * Rate.Z + q1 * Rate.Y - q2 * Rate.X);
+
+	if (AccelNorm > KINDA_SMALL_NUMBER)
+	{
+		const float ax = Accel.X / AccelNorm;
+		const float ay = Accel.Y / AccelNorm;
+		const float az = Accel.Z / AccelNorm;
+
+		const float _2q0 = 2.f * q0, _2q1 = 2.f * q1, _2q2 = 2.f * q2, _2q3 = 2.f * q3;
+		const float _4q0 = 4.f * q0, _4q1 = 4.f * q1, _4q2 = 4.f * q2;
+		const float _8q1 = 8.f * q1, _8q2 = 8.f * q2;
+		const float q0q0 = q0 * q0, q1q1 = q1 * q1, q2q2 = q2 * q2, q3q3 = q3 * q3;
+
+		// Gradient descent step on the gravity error
+		float s0 = _4q0 * q2q2 + _2q2 * ax + _4q0 * q1q1 - _2q1 * ay;
+		float s1 = _4q1 * q3q3 - _2q3 * ax + 4.f * q0q0 * q1 - _2q0 * ay - _4q1 + _8q1 * q1q1 + _8q1 * q2q2 + _4q1 * az;
+		float s2 = 4.f * q0q0 * q2 + _2q0 * ax + _4q2 * q3q3 - _2q3 * ay - _4q2 + _8q2 * q1q1 + _8q2 * q2q2 + _4q2 * az;
+		float s3 = 4.f * q1q1 * q3 - _2q1 * ax + 4.f * q2q2 * q3 - _2q2 * ay;
+
+		const float SNorm = FMath::Sqrt(s0 * s0 + s1 * s1 + s2 * s2 + s3 * s3);
+		if (SNorm > KINDA_SMALL_NUMBER)
+		{
+			const float Gain = (SinceInitSec < InitialSettleSec ? InitialBeta : Beta) / SNorm;
+			qDot1 -= Gain * s0;
+			qDot2 -= Gain * s1;
+			qDot3 -= Gain * s2;
+			qDot4 -= Gain * s3;
+		}
+	}
+
+	q0 += qDot1 * Dt;
+	q1 += qDot2 * Dt;
+	q2 += qDot3 * Dt;
+	q3 += qDot4 * Dt;
+
+	Q = FQuat4f(q1, q2, q3, q0);
+	Q.Normalize();
+
+	// Look deltas in the world frame: yaw about up, pitch about the horizontal projection of body x.
+	const FVector3f StepWorld = Q.RotateVector(RateDeg * Dt);
+	FVector3f Right = Q.RotateVector(FVector3f::UnitX());
+	Right.Z = 0.f;
+	if (!Right.Normalize())
+	{
+		// Body x is vertical; fall back to body y to pick the horizontal axis.
+		Right = Q.RotateVector(FVector3f::UnitY());
+		Right.Z = 0.f;
+		Right.Normalize();
+	}
+	LastYawPitchDeltaDeg = FVector2f(StepWorld.Z, FVector3f::DotProduct(StepWorld, Right));
+}
+
+void FSWIGyroAhrs::UpdateBias(const FVector3f& GyroDegPerSec, float AccelNorm, float Dt)
+{
+	const FVector3f Corrected = GyroDegPerSec - Bias;
+	const bool bQuietGyro = Corrected.Size() < StillGyroDegPerSec;
+
+	// Gravity magnitude is learned rather than assumed, so m/s^2 and g inputs both work.
+	if (bQuietGyro)
+	{
+		GravityNorm += (AccelNorm - GravityNorm) * FMath::Min(Dt, 1.f);
+	}
+
+	const bool bStill = bQuietGyro && FMath::Abs(AccelNorm - GravityNorm) < StillAccelTolerance * GravityNorm;
+	StillSec = bStill ? StillSec + Dt : 0.f;
+
+	if (IsStill())
+	{
+		const float Alpha = 1.f - FMath::Exp(-Dt / BiasTimeConstantSec);
+		Bias += (GyroDegPerSec - Bias) * Alpha;
+	}
+}
+
+void FSWIGyroAhrs::Reset()
+{
+	Q = FQuat4f::Identity;
+	Bias = FVector3f::ZeroVector;
+	LastYawPitchDeltaDeg = FVector2f::ZeroVector;
+	GravityNorm = 0.f;
+	StillSec = 0.f;
+	SinceInitSec = 0.f;
+	bInitialized = false;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Madgwick 6-axis orientation filter for one phone, with gyro bias learned while the phone is still.
+ *
+ * Inputs are in the W3C devicemotion body frame (x right, y up the screen, z out of the screen):
+ * accelerationIncludingGravity in any unit, and rotationRate as (beta, gamma, alpha) = rate about (x, y, z) in deg/s.
+ * The hub's Gx/Gy/Gz carry alpha/beta/gamma, so callers pass FVector3f(Gy, Gz, Gx).
+ *
+ * The orientation maps body to a gravity-aligned world frame (z up); heading is gyro-only and drifts slowly.
+ */
+struct SWI_API FSWIGyroAhrs
+{
+	// Madgwick gain once settled, and while converging right after the first sample.
+	float Beta = 0.08f;
+	float InitialBeta = 2.5f;
+	float InitialSettleSec = 1.0f;
+
+	// Still = accel magnitude within this fraction of gravity and bias-corrected rate below StillGyroDegPerSec.
+	float StillAccelTolerance = 0.05f;
+	float StillGyroDegPerSec = 4.0f;
+	float StillMinSec = 0.4f;
+	float BiasTimeConstantSec = 2.0f;
+
+	void Update(const FVector3f& GyroDegPerSec, const FVector3f& Accel, float Dt);
+	void Reset();
+
+	bool IsInitialized() const { return bInitialized; }
+	bool IsStill() const { return StillSec >= StillMinSec; }
+
+	const FQuat4f& GetOrientation() const { return Q; }
+	const FVector3f& GetGyroBias() const { return Bias; }
+
+	// Unit "up" (reaction to gravity) seen from the body frame, from the fused orientation.
+	FVector3f GetUpInBody() const { return Q.UnrotateVector(FVector3f::UnitZ()); }
+
+	// Rotation during the last Update about world up (yaw) and about the horizontal right axis (pitch), deg.
+	const FVector2f& GetLastYawPitchDeltaDeg() const { return LastYawPitchDeltaDeg; }
+
+private:
+	void UpdateBias(const FVector3f& GyroDegPerSec, float AccelNorm, float Dt);
+
+	FQuat4f Q = FQuat4f::Identity;
+	FVector3f Bias = FVector3f::ZeroVector;
+	FVector2f LastYawPitchDeltaDeg = FVector2f::ZeroVector;
+
+	float GravityNorm = 0.f;
+	float StillSec = 0.f;
+	float SinceInitSec = 0.f;
+	bool bInitialized = false;
+};
@@ -0,0 +1,525 @@
+#include "SWIGyroBatch.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+
+int32 FSWIGyroBatch::AddLane()
+{
+	int32 Lane = INDEX_NONE;
+	if (FreeLanes.Num() > 0)
+	{
+		Lane = FreeLanes.Pop(EAllowShrinking::No);
+	}
+	else
+	{
+		Lane = NumLanes++;
+		if (NumLanes > Capacity)
+		{
+			Grow(FMath::Max(Capacity * 2, Width));
+		}
+	}
+
+	ResetLane(Lane);
+	SetSmoothedMove(Lane, FVector2f::ZeroVector);
+	SetParams(Lane, FSWIGyroBatchParams());
+	return Lane;
+}
+
+void FSWIGyroBatch::RemoveLane(int32 Lane)
+{
+	if (!NumPending.IsValidIndex(Lane) || Lane >= NumLanes) return;
+
+	ResetLane(Lane);
+	FreeLanes.Add(Lane);
+}
+
+void FSWIGyroBatch::ResetLane(int32 Lane)
+{
+	if (!NumPending.IsValidIndex(Lane)) return;
+
+	for (int32 Sample = 0; Sample < NumPending[Lane]; ++Sample)
+	{
+		InValid[SampleIndex(Sample, Lane)] = 0.f;
+	}
+	NumPending[Lane] = 0;
+	HasNeutral[Lane] = 0.f;
+	LookYaw[Lane] = 0.f;
+	LookPitch[Lane] = 0.f;
+	LookDt[Lane] = 0.f;
+}
+
+void FSWIGyroBatch::SetSmoothedMove(int32 Lane, const FVector2f& Move)
+{
+	MoveForward[Lane] = Move.X;
+	MoveRight[Lane] = Move.Y;
+}
+
+void FSWIGyroBatch::SetParams(int32 Lane, const FSWIGyroBatchParams& Params)
+{
+	MaxTiltDeg[Lane] = Params.MoveMaxTiltDeg;
+	ForwardSign[Lane] = Params.MoveForwardSign;
+	RightSign[Lane] = Params.MoveRightSign;
+	DeadZone[Lane] = Params.MoveDeadZone;
+	SmoothingHz[Lane] = Params.MoveSmoothingHz;
+	YawScale[Lane] = Params.LookYawScale;
+	PitchScale[Lane] = Params.bInvertLookPitch ? -Params.LookPitchScale : Params.LookPitchScale;
+	FusedTilt[Lane] = Params.bFusedTilt ? 1.f : 0.f;
+}
+
+bool FSWIGyroBatch::Push(int32 Lane, const FSWIGyroBatchSample& Sample)
+{
+	check(NumPending.IsValidIndex(Lane));
+
+	int32& Count = NumPending[Lane];
+	if (Count >= MaxSamplesPerPass)
+	{
+		return false;
+	}
+
+	const int32 I = SampleIndex(Count, Lane);
+	InValid[I] = 1.f;
+	InDt[I] = Sample.Dt;
+	InX[I] = Sample.Tilt.X;
+	InY[I] = Sample.Tilt.Y;
+	InZ[I] = Sample.Tilt.Z;
+	InLookYaw[I] = Sample.RawLookDeg.X;
+	InLookPitch[I] = Sample.RawLookDeg.Y;
+	InMaxLook[I] = Sample.MaxLookDeltaDeg;
+
+	++Count;
+	MaxPending = FMath::Max(MaxPending, Count);
+	return true;
+}
+
+void FSWIGyroBatch::Grow(int32 NewCapacity)
+{
+	const int32 OldCapacity = Capacity;
+	Capacity = NewCapacity;
+
+	for (TArray<float>* Column : { &MaxTiltDeg, &ForwardSign, &RightSign, &DeadZone, &SmoothingHz, &YawScale, &PitchScale,
+		&FusedTilt, &HasNeutral, &NeutralRoll, &NeutralPitch, &NeutralUpX, &NeutralUpY, &NeutralUpZ, &MoveForward, &MoveRight,
+		&LookYaw, &LookPitch, &LookDt })
+	{
+		Column->SetNumZeroed(Capacity);
+	}
+	NumPending.SetNumZeroed(Capacity);
+
+	// Sample rows are Capacity wide, so pending samples move to their new row offsets.
+	for (TArray<float>* Column : { &InValid, &InDt, &InX, &InY, &InZ, &InLookYaw, &InLookPitch, &InMaxLook })
+	{
+		TArray<float> Old = MoveTemp(*Column);
+		Column->SetNumZeroed(Capacity * MaxSamplesPerPass);
+		for (int32 Sample = 0; Sample < MaxSamplesPerPass && OldCapacity > 0; ++Sample)
+		{
+			FMemory::Memcpy(&(*Column)[Sample * Capacity], &Old[Sample * OldCapacity], OldCapacity * sizeof(float));
+		}
+	}
+
+	// Padding lanes never get samples, but keep their math finite.
+	for (int32 Lane = OldCapacity; Lane < Capacity; ++Lane)
+	{
+		SetParams(Lane, FSWIGyroBatchParams());
+	}
+}
+
+static float BatchDeadZone(float V, float DeadZone)
+{
+	const float A = FMath::Abs(V);
+	if (A <= DeadZone) return 0.f;
+	return FMath::Sign(V) * FMath::Clamp((A - DeadZone) / (1.f - DeadZone), 0.f, 1.f);
+}
+
+FVector2f FSWIGyroBatch::ProcessSample(const FSWIGyroBatchParams& Params, FSWIGyroLaneState& State, const FSWIGyroBatchSample& Sample)
+{
+	float DeltaRoll = 0.f;
+	float DeltaPitch = 0.f;
+	if (Params.bFusedTilt)
+	{
+		// Tilt = rotation vector from the neutral up to the fused up, in body axes (no Euler, no gimbal lock).
+		const FVector3f Up = Sample.Tilt;
+		if (!State.bHasNeutral)
+		{
+			State.NeutralUp = Up;
+		}
+
+		const FVector3f Axis = FVector3f::CrossProduct(State.NeutralUp, Up);
+		const float SinA = Axis.Size();
+		const float AngleDeg = FMath::RadiansToDegrees(FMath::Atan2(SinA, FVector3f::DotProduct(State.NeutralUp, Up)));
+		const FVector3f Tilt = SinA > KINDA_SMALL_NUMBER ? Axis * (AngleDeg / SinA) : FVector3f::ZeroVector;
+
+		DeltaPitch = FMath::Clamp(Tilt.X, -90.f, 90.f);
+		DeltaRoll = FMath::Clamp(Tilt.Y, -90.f, 90.f);
+	}
+	else
+	{
+		const float Ax = Sample.Tilt.X;
+		const float Ay = Sample.Tilt.Y;
+		const float Az = Sample.Tilt.Z;
+		const float RollDeg = FMath::RadiansToDegrees(FMath::Atan2(Ax, Az));
+		const float PitchDeg = FMath::RadiansToDegrees(FMath::Atan2(-Ay, FMath::Sqrt(Ax * Ax + Az * Az)));
+		if (!State.bHasNeutral)
+		{
+			State.NeutralRollDeg = RollDeg;
+			State.NeutralPitchDeg = PitchDeg;
+		}
+
+		DeltaRoll = FMath::Clamp(FMath::FindDeltaAngleDegrees(State.NeutralRollDeg, RollDeg), -90.f, 90.f);
+		DeltaPitch = FMath::Clamp(FMath::FindDeltaAngleDegrees(State.NeutralPitchDeg, PitchDeg), -90.f, 90.f);
+	}
+	State.bHasNeutral = true;
+
+	const float Forward = BatchDeadZone(FMath::Clamp((DeltaPitch / Params.MoveMaxTiltDeg) * Params.MoveForwardSign, -1.f, 1.f), Params.MoveDeadZone);
+	const float Right = BatchDeadZone(FMath::Clamp((DeltaRoll / Params.MoveMaxTiltDeg) * Params.MoveRightSign, -1.f, 1.f), Params.MoveDeadZone);
+
+	const float Alpha = Params.MoveSmoothingHz > 0.f ? 1.f - FMath::Exp(-Params.MoveSmoothingHz * Sample.Dt) : 1.f;
+	State.Move = FMath::Lerp(State.Move, FVector2f(Forward, Right), Alpha);
+
+	// The clamp is symmetric, so inverting pitch before or after it is the same.
+	const float MaxLook = Sample.MaxLookDeltaDeg;
+	const float PitchScale = Params.bInvertLookPitch ? -Params.LookPitchScale : Params.LookPitchScale;
+	return FVector2f(
+		FMath::Clamp(Sample.RawLookDeg.X, -MaxLook, MaxLook) * Params.LookYawScale,
+		FMath::Clamp(Sample.RawLookDeg.Y, -MaxLook, MaxLook) * PitchScale);
+}
+
+void FSWIGyroBatch::ProcessScalar(int32 Lane, int32 Sample)
+{
+	const int32 I = SampleIndex(Sample, Lane);
+
+	FSWIGyroBatchParams Params;
+	Params.MoveMaxTiltDeg = MaxTiltDeg[Lane];
+	Params.MoveForwardSign = ForwardSign[Lane];
+	Params.MoveRightSign = RightSign[Lane];
+	Params.MoveDeadZone = DeadZone[Lane];
+	Params.MoveSmoothingHz = SmoothingHz[Lane];
+	Params.LookYawScale = YawScale[Lane];
+	Params.LookPitchScale = PitchScale[Lane];		// inversion already folded in
+	Params.bFusedTilt = FusedTilt[Lane] > 0.f;
+
+	FSWIGyroLaneState State;
+	State.bHasNeutral = HasNeutral[Lane] > 0.f;
+	State.NeutralRollDeg = NeutralRoll[Lane];
+	State.NeutralPitchDeg = NeutralPitch[Lane];
+	State.NeutralUp = FVector3f(NeutralUpX[Lane], NeutralUpY[Lane], NeutralUpZ[Lane]);
+	State.Move = FVector2f(MoveForward[Lane], MoveRight[Lane]);
+
+	FSWIGyroBatchSample In;
+	In.Dt = InDt[I];
+	In.Tilt = FVector3f(InX[I], InY[I], InZ[I]);
+	In.RawLookDeg = FVector2f(InLookYaw[I], InLookPitch[I]);
+	In.MaxLookDeltaDeg = InMaxLook[I];
+
+	const FVector2f Look = ProcessSample(Params, State, In);
+
+	HasNeutral[Lane] = 1.f;
+	NeutralRoll[Lane] = State.NeutralRollDeg;
+	NeutralPitch[Lane] = State.NeutralPitchDeg;
+	NeutralUpX[Lane] = State.NeutralUp.X;
+	NeutralUpY[Lane] = State.NeutralUp.Y;
+	NeutralUpZ[Lane] = State.NeutralUp.Z;
+	MoveForward[Lane] = State.Move.X;
+	MoveRight[Lane] = State.Move.Y;
+
+	LookYaw[Lane] += Look.X;
+	LookPitch[Lane] += Look.Y;
+	LookDt[Lane] += In.Dt;
+}
+
+void FSWIGyroBatch::RunScalar(TFunctionRef<void(int32 Lane, const FSWIGyroBatchResult& Result)> OnLaneDone)
+{
+	for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+	{
+		for (int32 Sample = 0; Sample < NumPending[Lane]; ++Sample)
+		{
+			ProcessScalar(Lane, Sample);
+		}
+	}
+	Report(OnLaneDone);
+}
+
+void FSWIGyroBatch::Run(TFunctionRef<void(int32 Lane, const FSWIGyroBatchResult& Result)> OnLaneDone)
+{
+	if (MaxPending == 0) return;
+
+	const VectorRegister4Float Zero = VectorZeroFloat();
+	const VectorRegister4Float One = VectorOneFloat();
+	const VectorRegister4Float MinusOne = VectorNegate(One);
+	const VectorRegister4Float RadToDeg = VectorSetFloat1(180.f / UE_PI);
+	const VectorRegister4Float Deg90 = VectorSetFloat1(90.f);
+	const VectorRegister4Float MinusDeg90 = VectorSetFloat1(-90.f);
+	const VectorRegister4Float Deg180 = VectorSetFloat1(180.f);
+	const VectorRegister4Float MinusDeg180 = VectorSetFloat1(-180.f);
+	const VectorRegister4Float Deg360 = VectorSetFloat1(360.f);
+	const VectorRegister4Float SmallNumber = VectorSetFloat1(KINDA_SMALL_NUMBER);
+
+	auto Clamp = [](const VectorRegister4Float& V, const VectorRegister4Float& Lo, const VectorRegister4Float& Hi)
+	{
+		return VectorMin(VectorMax(V, Lo), Hi);
+	};
+	// FMath::FindDeltaAngleDegrees for angles in [-180, 180]
+	auto DeltaAngle = [&](const VectorRegister4Float& From, const VectorRegister4Float& To)
+	{
+		const VectorRegister4Float Delta = VectorSubtract(To, From);
+		return VectorSelect(VectorCompareGT(Delta, Deg180), VectorSubtract(Delta, Deg360),
+			VectorSelect(VectorCompareLT(Delta, MinusDeg180), VectorAdd(Delta, Deg360), Delta));
+	};
+	auto DeadZoneV = [&](const VectorRegister4Float& V, const VectorRegister4Float& Dz)
+	{
+		const VectorRegister4Float A = VectorAbs(V);
+		const VectorRegister4Float T = Clamp(VectorDivide(VectorSubtract(A, Dz), VectorSubtract(One, Dz)), Zero, One);
+		return VectorSelect(VectorCompareLE(A, Dz), Zero, VectorMultiply(VectorSign(V), T));
+	};
+
+	for (int32 Lane = 0; Lane < Capacity; Lane += Width)
+	{
+		const VectorRegister4Float MaxTilt = VectorLoad(&MaxTiltDeg[Lane]);
+		const VectorRegister4Float FwdSign = VectorLoad(&ForwardSign[Lane]);
+		const VectorRegister4Float RgtSign = VectorLoad(&RightSign[Lane]);
+		const VectorRegister4Float Dz = VectorLoad(&DeadZone[Lane]);
+		const VectorRegister4Float Hz = VectorLoad(&SmoothingHz[Lane]);
+		const VectorRegister4Float YawK = VectorLoad(&YawScale[Lane]);
+		const VectorRegister4Float PitchK = VectorLoad(&PitchScale[Lane]);
+		const VectorRegister4Float Fused = VectorCompareGT(VectorLoad(&FusedTilt[Lane]), Zero);
+		const VectorRegister4Float NoSmoothing = VectorCompareLE(Hz, Zero);
+		const VectorRegister4Float NegHz = VectorNegate(Hz);
+
+		VectorRegister4Float Neutral = VectorLoad(&HasNeutral[Lane]);
+		VectorRegister4Float NRoll = VectorLoad(&NeutralRoll[Lane]);
+		VectorRegister4Float NPitch = VectorLoad(&NeutralPitch[Lane]);
+		VectorRegister4Float NUx = VectorLoad(&NeutralUpX[Lane]);
+		VectorRegister4Float NUy = VectorLoad(&NeutralUpY[Lane]);
+		VectorRegister4Float NUz = VectorLoad(&NeutralUpZ[Lane]);
+		VectorRegister4Float MoveF = VectorLoad(&MoveForward[Lane]);
+		VectorRegister4Float MoveR = VectorLoad(&MoveRight[Lane]);
+		VectorRegister4Float SumYaw = VectorLoad(&LookYaw[Lane]);
+		VectorRegister4Float SumPitch = VectorLoad(&LookPitch[Lane]);
+		VectorRegister4Float SumDt = VectorLoad(&LookDt[Lane]);
+
+		for (int32 Sample = 0; Sample < MaxPending; ++Sample)
+		{
+			const int32 I = SampleIndex(Sample, Lane);
+			const VectorRegister4Float Valid = VectorCompareGT(VectorLoad(&InValid[I]), Zero);
+			if (!VectorMaskBits(Valid))
+			{
+				break;	// samples are packed from row 0, so these lanes have no more
+			}
+
+			const VectorRegister4Float Dt = VectorLoad(&InDt[I]);
+			const VectorRegister4Float X = VectorLoad(&InX[I]);
+			const VectorRegister4Float Y = VectorLoad(&InY[I]);
+			const VectorRegister4Float Z = VectorLoad(&InZ[I]);
+
+			// Neutral pose on the first sample. Both kinds are captured; the lane's mode picks one below.
+			const VectorRegister4Float HadNeutral = VectorCompareGT(Neutral, Zero);
+
+			// Legacy: accelerometer roll / pitch relative to neutral.
+			const VectorRegister4Float RollDeg = VectorMultiply(VectorATan2(X, Z), RadToDeg);
+			const VectorRegister4Float PitchDeg = VectorMultiply(
+				VectorATan2(VectorNegate(Y), VectorSqrt(VectorMultiplyAdd(X, X, VectorMultiply(Z, Z)))), RadToDeg);
+			const VectorRegister4Float NewNRoll = VectorSelect(HadNeutral, NRoll, RollDeg);
+			const VectorRegister4Float NewNPitch = VectorSelect(HadNeutral, NPitch, PitchDeg);
+			const VectorRegister4Float LegacyRoll = Clamp(DeltaAngle(NewNRoll, RollDeg), MinusDeg90, Deg90);
+			const VectorRegister4Float LegacyPitch = Clamp(DeltaAngle(NewNPitch, PitchDeg), MinusDeg90, Deg90);
+
+			// Fused: rotation vector from neutral up to up.
+			const VectorRegister4Float NewNUx = VectorSelect(HadNeutral, NUx, X);
+			const VectorRegister4Float NewNUy = VectorSelect(HadNeutral, NUy, Y);
+			const VectorRegister4Float NewNUz = VectorSelect(HadNeutral, NUz, Z);
+			const VectorRegister4Float AxisX = VectorSubtract(VectorMultiply(NewNUy, Z), VectorMultiply(NewNUz, Y));
+			const VectorRegister4Float AxisY = VectorSubtract(VectorMultiply(NewNUz, X), VectorMultiply(NewNUx, Z));
+			const VectorRegister4Float AxisZ = VectorSubtract(VectorMultiply(NewNUx, Y), VectorMultiply(NewNUy, X));
+			const VectorRegister4Float SinA = VectorSqrt(
+				VectorMultiplyAdd(AxisX, AxisX, VectorMultiplyAdd(AxisY, AxisY, VectorMultiply(AxisZ, AxisZ))));
+			const VectorRegister4Float CosA = VectorMultiplyAdd(NewNUx, X, VectorMultiplyAdd(NewNUy, Y, VectorMultiply(NewNUz, Z)));
+			const VectorRegister4Float AngleDeg = VectorMultiply(VectorATan2(SinA, CosA), RadToDeg);
+			const VectorRegister4Float AxisScale = VectorSelect(VectorCompareGT(SinA, SmallNumber), VectorDivide(AngleDeg, SinA), Zero);
+			const VectorRegister4Float FusedPitch = Clamp(VectorMultiply(AxisX, AxisScale), MinusDeg90, Deg90);
+			const VectorRegister4Float FusedRoll = Clamp(VectorMultiply(AxisY, AxisScale), MinusDeg90, Deg90);
+
+			const VectorRegister4Float DeltaPitch = VectorSelect(Fused, FusedPitch, LegacyPitch);
+			const VectorRegister4Float DeltaRoll = VectorSelect(Fused, FusedRoll, LegacyRoll);
+
+			// Tilt -> move, dead zone, smoothing
+			const VectorRegister4Float Forward = DeadZoneV(Clamp(VectorMultiply(VectorDivide(DeltaPitch, MaxTilt), FwdSign), MinusOne, One), Dz);
+			const VectorRegister4Float Right = DeadZoneV(Clamp(VectorMultiply(VectorDivide(DeltaRoll, MaxTilt), RgtSign), MinusOne, One), Dz);
+			const VectorRegister4Float Alpha = VectorSelect(NoSmoothing, One, VectorSubtract(One, VectorExp(VectorMultiply(NegHz, Dt))));
+			const VectorRegister4Float NewMoveF = VectorMultiplyAdd(VectorSubtract(Forward, MoveF), Alpha, MoveF);
+			const VectorRegister4Float NewMoveR = VectorMultiplyAdd(VectorSubtract(Right, MoveR), Alpha, MoveR);
+
+			// Look clamp and scale
+			const VectorRegister4Float MaxLook = VectorLoad(&InMaxLook[I]);
+			const VectorRegister4Float MinLook = VectorNegate(MaxLook);
+			const VectorRegister4Float Yaw = VectorMultiply(Clamp(VectorLoad(&InLookYaw[I]), MinLook, MaxLook), YawK);
+			const VectorRegister4Float Pitch = VectorMultiply(Clamp(VectorLoad(&InLookPitch[I]), MinLook, MaxLook), PitchK);
+
+			// Lanes without this sample keep their state.
+			Neutral = VectorSelect(Valid, One, Neutral);
+			NRoll = VectorSelect(Valid, NewNRoll, NRoll);
+			NPitch = VectorSelect(Valid, NewNPitch, NPitch);
+			NUx = VectorSelect(Valid, NewNUx, NUx);
+			NUy = VectorSelect(Valid, NewNUy, NUy);
+			NUz = VectorSelect(Valid, NewNUz, NUz);
+			MoveF = VectorSelect(Valid, NewMoveF, MoveF);
+			MoveR = VectorSelect(Valid, NewMoveR, MoveR);
+			SumYaw = VectorAdd(SumYaw, VectorSelect(Valid, Yaw, Zero));
+			SumPitch = VectorAdd(SumPitch, VectorSelect(Valid, Pitch, Zero));
+			SumDt = VectorAdd(SumDt, VectorSelect(Valid, Dt, Zero));
+		}
+
+		VectorStore(Neutral, &HasNeutral[Lane]);
+		VectorStore(NRoll, &NeutralRoll[Lane]);
+		VectorStore(NPitch, &NeutralPitch[Lane]);
+		VectorStore(NUx, &NeutralUpX[Lane]);
+		VectorStore(NUy, &NeutralUpY[Lane]);
+		VectorStore(NUz, &NeutralUpZ[Lane]);
+		VectorStore(MoveF, &MoveForward[Lane]);
+		VectorStore(MoveR, &MoveRight[Lane]);
+		VectorStore(SumYaw, &LookYaw[Lane]);
+		VectorStore(SumPitch, &LookPitch[Lane]);
+		VectorStore(SumDt, &LookDt[Lane]);
+	}
+
+	Report(OnLaneDone);
+}
+
+void FSWIGyroBatch::Report(TFunctionRef<void(int32 Lane, const FSWIGyroBatchResult& Result)> OnLaneDone)
+{
+	MaxPending = 0;
+
+	for (int32 Lane = 0; Lane < NumLanes; ++Lane)
+	{
+		if (NumPending[Lane] == 0) continue;
+
+		FSWIGyroBatchResult Result;
+		Result.Move = FVector2f(MoveForward[Lane], MoveRight[Lane]);
+		Result.LookDeltaDeg = FVector2f(LookYaw[Lane], LookPitch[Lane]);
+		Result.Dt = LookDt[Lane];
+		Result.NumSamples = NumPending[Lane];
+
+		for (int32 Sample = 0; Sample < NumPending[Lane]; ++Sample)
+		{
+			InValid[SampleIndex(Sample, Lane)] = 0.f;
+		}
+		NumPending[Lane] = 0;
+		LookYaw[Lane] = 0.f;
+		LookPitch[Lane] = 0.f;
+		LookDt[Lane] = 0.f;
+
+		OnLaneDone(Lane, Result);
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+
+// ---- Self-check / benchmark ----
+// SWI.Gyro.BenchBatch [Passes]
+// 8, 32 and 128 lanes (half fused, half legacy tilt, mixed params) fed the same random walk; Run must agree with
+// RunScalar (the receiver's own ProcessSample kernel), and the log shows ns per sample for both.
+
+static void RunGyroBatchBenchmark(const TArray<FString>& Args)
+{
+	const int32 Passes = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 2000;
+	constexpr int32 SamplesPerPass = 2;	// ~100 Hz phones at 60 fps
+
+	bool bAllOk = true;
+	for (const int32 NumDevices : { 8, 32, 128 })
+	{
+		FRandomStream Rng(NumDevices);
+		FSWIGyroBatch Simd;
+		FSWIGyroBatch Scalar;
+
+		struct FDeviceWalk
+		{
+			bool bFused = false;
+			FVector3f Tilt = FVector3f::ZeroVector;
+			FVector2f Rate = FVector2f::ZeroVector;
+		};
+		TArray<FDeviceWalk> Walks;
+		for (int32 Device = 0; Device < NumDevices; ++Device)
+		{
+			FSWIGyroBatchParams Params;
+			Params.bFusedTilt = Device % 2 == 0;
+			Params.MoveMaxTiltDeg = Rng.FRandRange(10.f, 30.f);
+			Params.MoveDeadZone = Rng.FRandRange(0.f, 0.2f);
+			Params.MoveSmoothingHz = Device % 7 == 0 ? 0.f : Rng.FRandRange(4.f, 20.f);
+			Params.MoveRightSign = Device % 3 == 0 ? -1.f : 1.f;
+			Params.LookYawScale = Rng.FRandRange(0.5f, 2.f);
+			Params.LookPitchScale = Rng.FRandRange(0.5f, 2.f);
+			Params.bInvertLookPitch = Device % 2 == 1;
+
+			const int32 A = Simd.AddLane();
+			const int32 B = Scalar.AddLane();
+			check(A == Device && B == Device);
+			Simd.SetParams(A, Params);
+			Scalar.SetParams(B, Params);
+
+			FDeviceWalk& Walk = Walks.AddDefaulted_GetRef();
+			Walk.bFused = Params.bFusedTilt;
+			Walk.Tilt = Params.bFusedTilt ? FVector3f::UnitZ() : FVector3f(0.f, 0.f, 9.81f);
+		}
+
+		double SimdSec = 0.0;
+		double ScalarSec = 0.0;
+		float MaxMoveErr = 0.f;
+		float MaxLookErr = 0.f;
+		TArray<FSWIGyroBatchResult> Expected;
+		Expected.SetNum(NumDevices);
+
+		for (int32 Pass = 0; Pass < Passes; ++Pass)
+		{
+			for (int32 Device = 0; Device < NumDevices; ++Device)
+			{
+				FDeviceWalk& Walk = Walks[Device];
+				for (int32 i = 0; i < SamplesPerPass; ++i)
+				{
+					// Tilt wanders up to ~60 deg from neutral; look rates swing past the per-sample clamp.
+					const FVector3f Nudge(Rng.FRandRange(-0.05f, 0.05f), Rng.FRandRange(-0.05f, 0.05f), 0.f);
+					const float G = Walk.bFused ? 1.f : 9.81f;
+					Walk.Tilt = (Walk.Tilt / G + Nudge).GetSafeNormal() * G;
+					if (Walk.Tilt.Z < 0.5f * G)
+					{
+						Walk.Tilt = FVector3f(0.f, 0.f, G);
+					}
+					Walk.Rate = Walk.Rate * 0.9f + FVector2f(Rng.FRandRange(-200.f, 200.f), Rng.FRandRange(-200.f, 200.f)) * 0.1f;
+
+					FSWIGyroBatchSample Sample;
+					Sample.Dt = 0.01f + Rng.FRandRange(-0.002f, 0.002f);
+					Sample.Tilt = Walk.Tilt;
+					Sample.RawLookDeg = Walk.Rate * Sample.Dt * 5.f;
+					Sample.MaxLookDeltaDeg = 8.f;
+					Simd.Push(Device, Sample);
+					Scalar.Push(Device, Sample);
+				}
+			}
+
+			double Start = FPlatformTime::Seconds();
+			Scalar.RunScalar([&Expected](int32 Lane, const FSWIGyroBatchResult& Result) { Expected[Lane] = Result; });
+			ScalarSec += FPlatformTime::Seconds() - Start;
+
+			Start = FPlatformTime::Seconds();
+			Simd.Run([&Expected, &MaxMoveErr, &MaxLookErr](int32 Lane, const FSWIGyroBatchResult& Result)
+			{
+				MaxMoveErr = FMath::Max(MaxMoveErr, (Result.Move - Expected[Lane].Move).GetAbsMax());
+				MaxLookErr = FMath::Max(MaxLookErr, (Result.LookDeltaDeg - Expected[Lane].LookDeltaDeg).GetAbsMax());
+			});
+			SimdSec += FPlatformTime::Seconds() - Start;
+		}
+
+		const double NumSamples = static_cast<double>(Passes) * NumDevices * SamplesPerPass;
+		const bool bOk = MaxMoveErr < 1.0e-3f && MaxLookErr < 1.0e-3f;
+		bAllOk &= bOk;
+		UE_LOG(LogTemp, Log, TEXT("[GYRO] BenchBatch devices=%d passes=%d | scalar=%.1f ns/sample simd=%.1f ns/sample (x%.2f) | max err move=%.2g look=%.2g deg %s"),
+			NumDevices, Passes, ScalarSec * 1.0e9 / NumSamples, SimdSec * 1.0e9 / NumSamples,
+			SimdSec > 0.0 ? ScalarSec / SimdSec : 0.0, MaxMoveErr, MaxLookErr, bOk ? TEXT("OK") : TEXT("MISMATCH"));
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[GYRO] BenchBatch %s"), bAllOk ? TEXT("PASSED") : TEXT("FAILED"));
+}
+
+static FAutoConsoleCommand GSWIGyroBenchBatchCmd(
+	TEXT("SWI.Gyro.BenchBatch"),
+	TEXT("Run the batched gyro math (SIMD) against the per-lane scalar reference at 8, 32 and 128 devices. Args: [Passes]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&RunGyroBatchBenchmark)
+);
+
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,138 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FSWIGyroBatchParams
+{
+	float MoveMaxTiltDeg = 18.f;
+	float MoveForwardSign = 1.f;
+	float MoveRightSign = 1.f;
+	float MoveDeadZone = 0.08f;
+	float MoveSmoothingHz = 12.f;
+	float LookYawScale = 1.f;
+	float LookPitchScale = 1.f;
+	bool bInvertLookPitch = false;
+
+	// Tilt input is the fused up vector in body axes; otherwise raw accelerometer (Atan2 roll / pitch).
+	bool bFusedTilt = true;
+};
+
+struct FSWIGyroBatchSample
+{
+	float Dt = 0.f;
+
+	// Fused: up in body axes. Legacy: ax, ay, az.
+	FVector3f Tilt = FVector3f::ZeroVector;
+
+	// Unscaled yaw / pitch step (deg) and its per-sample clamp.
+	FVector2f RawLookDeg = FVector2f::ZeroVector;
+	float MaxLookDeltaDeg = 8.f;
+};
+
+// What a lane keeps between samples: the neutral pose (captured on the first sample) and the smoothed move.
+struct FSWIGyroLaneState
+{
+	bool bHasNeutral = false;
+	float NeutralRollDeg = 0.f;
+	float NeutralPitchDeg = 0.f;
+	FVector3f NeutralUp = FVector3f::UnitZ();
+	FVector2f Move = FVector2f::ZeroVector;
+};
+
+struct FSWIGyroBatchResult
+{
+	// X = forward, Y = right (smoothed), like the receiver's move axis.
+	FVector2f Move = FVector2f::ZeroVector;
+
+	// Scaled look rotation summed over the lane's samples in this pass, and the time they cover.
+	FVector2f LookDeltaDeg = FVector2f::ZeroVector;
+	float Dt = 0.f;
+	int32 NumSamples = 0;
+};
+
+/**
+ * Move / look math of many gyro receivers as structure-of-arrays, run for every lane in one pass.
+ *
+ * The math after the receiver's filter step: tilt from the neutral pose (fused up vector or accelerometer Atan2),
+ * tilt -> move scale, dead zone, exponential smoothing, look clamp and scale. ProcessSample() is the one scalar
+ * kernel: RunScalar() applies it per lane and the receiver calls it directly when it does not batch, so Run(), which
+ * does four lanes per VectorRegister4Float, is checked against the math the receiver actually runs.
+ * A lane holds up to MaxSamplesPerPass samples between passes; they are processed in order, so smoothing is exact.
+ * Game thread.
+ */
+class SWI_API FSWIGyroBatch
+{
+public:
+	static constexpr int32 MaxSamplesPerPass = 8;
+
+	int32 AddLane();
+	void RemoveLane(int32 Lane);
+
+	// Forgets the neutral pose and drops pending samples; smoothed move carries over like in the receiver.
+	void ResetLane(int32 Lane);
+	void SetSmoothedMove(int32 Lane, const FVector2f& Move);
+
+	void SetParams(int32 Lane, const FSWIGyroBatchParams& Params);
+
+	// False when the lane already holds MaxSamplesPerPass samples (run a pass first).
+	bool Push(int32 Lane, const FSWIGyroBatchSample& Sample);
+
+	// Processes every pending sample, then reports each lane that had one. Handlers must not push.
+	void Run(TFunctionRef<void(int32 Lane, const FSWIGyroBatchResult& Result)> OnLaneDone);
+	void RunScalar(TFunctionRef<void(int32 Lane, const FSWIGyroBatchResult& Result)> OnLaneDone);
+
+	// One sample through the scalar kernel. Updates State and returns the scaled look delta (deg).
+	static FVector2f ProcessSample(const FSWIGyroBatchParams& Params, FSWIGyroLaneState& State, const FSWIGyroBatchSample& Sample);
+
+	int32 GetNumLanes() const { return NumLanes - FreeLanes.Num(); }
+	bool HasPending() const { return MaxPending > 0; }
+
+private:
+	static constexpr int32 Width = 4;
+
+	void Grow(int32 NewCapacity);
+	void ProcessScalar(int32 Lane, int32 Sample);
+	void Report(TFunctionRef<void(int32 Lane, const FSWIGyroBatchResult& Result)> OnLaneDone);
+	int32 SampleIndex(int32 Sample, int32 Lane) const { return Sample * Capacity + Lane; }
+
+	int32 NumLanes = 0;
+	int32 Capacity = 0;		// multiple of Width
+	int32 MaxPending = 0;
+	TArray<int32> FreeLanes;
+	TArray<int32> NumPending;
+
+	// Params (per lane)
+	TArray<float> MaxTiltDeg;
+	TArray<float> ForwardSign;
+	TArray<float> RightSign;
+	TArray<float> DeadZone;
+	TArray<float> SmoothingHz;
+	TArray<float> YawScale;
+	TArray<float> PitchScale;		// look pitch inversion folded in (the clamp is symmetric)
+	TArray<float> FusedTilt;		// 1 = fused, 0 = legacy
+
+	// State (per lane)
+	TArray<float> HasNeutral;
+	TArray<float> NeutralRoll;
+	TArray<float> NeutralPitch;
+	TArray<float> NeutralUpX;
+	TArray<float> NeutralUpY;
+	TArray<float> NeutralUpZ;
+	TArray<float> MoveForward;
+	TArray<float> MoveRight;
+
+	// Output (per lane, this pass)
+	TArray<float> LookYaw;
+	TArray<float> LookPitch;
+	TArray<float> LookDt;
+
+	// Samples ([Sample][Lane])
+	TArray<float> InValid;
+	TArray<float> InDt;
+	TArray<float> InX;
+	TArray<float> InY;
+	TArray<float> InZ;
+	TArray<float> InLookYaw;
+	TArray<float> InLookPitch;
+	TArray<float> InMaxLook;
+};
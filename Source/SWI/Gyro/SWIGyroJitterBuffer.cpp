@@ -0,0 +1,239 @@
+#include "SWIGyroJitterBuffer.h"
+
+namespace
+{
+	float LerpAngle(float A, float B, float T)
+	{
+		return A + FMath::FindDeltaAngleDegrees(A, B) * T;
+	}
+
+	void LerpFrame(const FSWIHubImuFrame& A, const FSWIHubImuFrame& B, float T, FSWIHubImuFrame& Out)
+	{
+		Out.Yaw = LerpAngle(A.Yaw, B.Yaw, T);
+		Out.Pitch = LerpAngle(A.Pitch, B.Pitch, T);
+		Out.Roll = LerpAngle(A.Roll, B.Roll, T);
+
+		Out.Ax = FMath::Lerp(A.Ax, B.Ax, T);
+		Out.Ay = FMath::Lerp(A.Ay, B.Ay, T);
+		Out.Az = FMath::Lerp(A.Az, B.Az, T);
+
+		Out.Gx = FMath::Lerp(A.Gx, B.Gx, T);
+		Out.Gy = FMath::Lerp(A.Gy, B.Gy, T);
+		Out.Gz = FMath::Lerp(A.Gz, B.Gz, T);
+	}
+}
+
+void FSWIGyroJitterBuffer::Push(const FSWIHubImuFrame& Frame)
+{
+	if (Frame.TsMs <= 0.0) return;
+
+	if (bHasPlayed && Frame.TsMs <= LastPlayMs)
+	{
+		++NumLate;
+		return;
+	}
+
+	if (Samples.Num() > 0 && Frame.TsMs > Samples.Last().TsMs)
+	{
+		SendIntervalMs += (static_cast<float>(Frame.TsMs - Samples.Last().TsMs) - SendIntervalMs) * 0.1f;
+	}
+
+	UpdateClockModel(Frame.RecvTimeSec * 1000.0, Frame.RecvTimeSec * 1000.0 - Frame.TsMs);
+
+	// Usually appends; late arrivals inside the window are inserted in order, duplicates dropped.
+	int32 Insert = Samples.Num();
+	while (Insert > 0 && Samples[Insert - 1].TsMs > Frame.TsMs) --Insert;
+	if (Insert > 0 && Samples[Insert - 1].TsMs == Frame.TsMs) return;
+
+	Samples.Insert(Frame, Insert);
+	if (Samples.Num() > MaxSamples)
+	{
+		Samples.RemoveAt(0, Samples.Num() - MaxSamples, EAllowShrinking::No);
+	}
+}
+
+void FSWIGyroJitterBuffer::UpdateClockModel(double LocalMs, double OffsetMs)
+{
+	if (!bHasClock)
+	{
+		OriginMs = LocalMs;
+		BaseOffsetMs = OffsetMs;
+		DriftPerMs = 0.0;
+		LastTransitMs = OffsetMs;
+		TargetDelayMs = MinDelayMs;
+		Window.Reset(WindowSize);
+		WindowHead = 0;
+		bHasClock = true;
+	}
+
+	// RFC 3550: J += (|D| - J) / 16
+	const double D = OffsetMs - LastTransitMs;
+	LastTransitMs = OffsetMs;
+	JitterMs += (static_cast<float>(FMath::Abs(D)) - JitterMs) / 16.f;
+
+	const FObservation Obs{ LocalMs - OriginMs, OffsetMs };
+	if (Window.Num() < WindowSize) Window.Add(Obs);
+	else Window[WindowHead] = Obs;
+	WindowHead = (WindowHead + 1) % WindowSize;
+
+	const int32 N = Window.Num();
+
+	// Drift: per-second minimum offsets are nearly free of queuing noise, so fit the slope on those
+	// (the fine window is far too short to see tens of ppm under burst jitter).
+	if (!bHasBucket || Obs.LocalMs - BucketStartMs >= 1000.0)
+	{
+		if (bHasBucket)
+		{
+			if (Minima.Num() < MinimaSize) Minima.Add(BucketMin);
+			else Minima[MinimaHead] = BucketMin;
+			MinimaHead = (MinimaHead + 1) % MinimaSize;
+		}
+		BucketStartMs = Obs.LocalMs;
+		BucketMin = Obs;
+		bHasBucket = true;
+	}
+	else if (Obs.OffsetMs < BucketMin.OffsetMs)
+	{
+		BucketMin = Obs;
+	}
+
+	double Slope = 0.0;
+	if (Minima.Num() >= 8)
+	{
+		double MeanT = 0.0, MeanO = 0.0;
+		double MinT = TNumericLimits<double>::Max(), MaxT = TNumericLimits<double>::Lowest();
+		for (const FObservation& O : Minima)
+		{
+			MeanT += O.LocalMs;
+			MeanO += O.OffsetMs;
+			MinT = FMath::Min(MinT, O.LocalMs);
+			MaxT = FMath::Max(MaxT, O.LocalMs);
+		}
+		MeanT /= Minima.Num();
+		MeanO /= Minima.Num();
+
+		double Cov = 0.0, Var = 0.0;
+		for (const FObservation& O : Minima)
+		{
+			Cov += (O.LocalMs - MeanT) * (O.OffsetMs - MeanO);
+			Var += (O.LocalMs - MeanT) * (O.LocalMs - MeanT);
+		}
+		if ((MaxT - MinT) >= 5000.0 && Var > 0.0)
+		{
+			Slope = FMath::Clamp(Cov / Var, -1.0e-3, 1.0e-3);
+		}
+	}
+	DriftPerMs = Slope;
+
+	// Lower envelope of the drift-corrected offsets = a packet that did not queue.
+	double Base = TNumericLimits<double>::Max();
+	for (const FObservation& O : Window)
+	{
+		Base = FMath::Min(Base, O.OffsetMs - DriftPerMs * O.LocalMs);
+	}
+	BaseOffsetMs = Base;
+
+	// Residual queuing delay percentile plus one send interval (so a right-hand sample exists) -> target delay.
+	Scratch.Reset(N);
+	for (const FObservation& O : Window)
+	{
+		Scratch.Add(static_cast<float>(O.OffsetMs - OffsetAt(O.LocalMs + OriginMs)));
+	}
+	Scratch.Sort();
+	const int32 Rank = FMath::Clamp(FMath::CeilToInt32(DelayPercentile * N) - 1, 0, N - 1);
+	const float Wanted = FMath::Clamp(Scratch[Rank] + SendIntervalMs, MinDelayMs, MaxDelayMs);
+
+	// Grow quickly to stop underruns, shrink slowly so latency does not oscillate.
+	const float Rate = Wanted > TargetDelayMs ? 0.5f : 0.02f;
+	TargetDelayMs += (Wanted - TargetDelayMs) * Rate;
+}
+
+FSWIGyroJitterBuffer::EPlayout FSWIGyroJitterBuffer::Playout(double NowSec, FSWIHubImuFrame& Out)
+{
+	if (Samples.Num() == 0 || !bHasClock)
+	{
+		return EPlayout::Empty;
+	}
+
+	const double NowMs = NowSec * 1000.0;
+	const double PlayMs = NowMs - OffsetAt(NowMs) - TargetDelayMs;
+	if (bHasPlayed && PlayMs <= LastPlayMs)
+	{
+		// A growing delay target pauses playout instead of rewinding it.
+		return EPlayout::Empty;
+	}
+
+	int32 A = INDEX_NONE;
+	for (int32 i = 0; i < Samples.Num() && Samples[i].TsMs <= PlayMs; ++i)
+	{
+		A = i;
+	}
+	if (A == INDEX_NONE)
+	{
+		return EPlayout::Empty;
+	}
+
+	EPlayout Result;
+	const FSWIHubImuFrame& SA = Samples[A];
+	if (A + 1 < Samples.Num())
+	{
+		const FSWIHubImuFrame& SB = Samples[A + 1];
+		const float T = static_cast<float>((PlayMs - SA.TsMs) / (SB.TsMs - SA.TsMs));
+		Out = SA;
+		LerpFrame(SA, SB, T, Out);
+		Result = EPlayout::Interpolated;
+	}
+	else if ((PlayMs - SA.TsMs) <= MaxExtrapolationMs)
+	{
+		Out = SA;
+		if (A > 0)
+		{
+			// Angles and acceleration continue along the last segment; rates are held.
+			const FSWIHubImuFrame& SP = Samples[A - 1];
+			const float T = static_cast<float>((PlayMs - SP.TsMs) / (SA.TsMs - SP.TsMs));
+			LerpFrame(SP, SA, T, Out);
+			Out.Gx = SA.Gx;
+			Out.Gy = SA.Gy;
+			Out.Gz = SA.Gz;
+		}
+		Result = EPlayout::Extrapolated;
+	}
+	else
+	{
+		Out = SA;
+		return EPlayout::Stale;
+	}
+
+	Out.TsMs = PlayMs;
+
+	LastPlayMs = PlayMs;
+	bHasPlayed = true;
+
+	// Keep one sample at or before the playout time as the next left bracket.
+	if (A > 0)
+	{
+		Samples.RemoveAt(0, A, EAllowShrinking::No);
+	}
+
+	return Result;
+}
+
+void FSWIGyroJitterBuffer::Reset()
+{
+	Samples.Reset();
+	Window.Reset();
+	WindowHead = 0;
+	Minima.Reset();
+	MinimaHead = 0;
+	bHasBucket = false;
+
+	bHasClock = false;
+	BaseOffsetMs = 0.0;
+	DriftPerMs = 0.0;
+	JitterMs = 0.f;
+	TargetDelayMs = 0.f;
+	SendIntervalMs = 0.f;
+
+	bHasPlayed = false;
+	LastPlayMs = 0.0;
+}
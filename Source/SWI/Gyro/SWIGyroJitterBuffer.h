@@ -0,0 +1,82 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SWI/SWIHubProtocolTypes.h"
+
+/**
+ * Per-device playout buffer for bursty phone IMU streams.
+ *
+ * Clock model: every packet gives an observation (local receive ms - sender TsMs). A least-squares slope over
+ * per-second minimum observations estimates drift, and the lower envelope of the drift-corrected recent observations
+ * is the offset of a packet that saw no queuing. The residual above that envelope is the per-packet network jitter.
+ *
+ * Playout runs on the sender timeline, TargetDelayMs behind "now": samples are interpolated between the two that
+ * bracket the playout time, extrapolated for at most MaxExtrapolationMs across a gap, and then reported stale.
+ * The target delay follows a percentile of the measured residuals (fast up, slow down).
+ */
+class SWI_API FSWIGyroJitterBuffer
+{
+public:
+	enum class EPlayout : uint8
+	{
+		Empty,			// nothing to play yet
+		Interpolated,
+		Extrapolated,
+		Stale,			// gap longer than MaxExtrapolationMs; hold, do not integrate
+	};
+
+	float MinDelayMs = 10.f;
+	float MaxDelayMs = 150.f;
+	float DelayPercentile = 0.95f;
+	float MaxExtrapolationMs = 50.f;
+
+	void Push(const FSWIHubImuFrame& Frame);
+	EPlayout Playout(double NowSec, FSWIHubImuFrame& Out);
+	void Reset();
+
+	float GetJitterMs() const { return JitterMs; }
+	float GetTargetDelayMs() const { return TargetDelayMs; }
+	double GetClockOffsetMs(double NowSec) const { return OffsetAt(NowSec * 1000.0); }
+	double GetClockDriftPpm() const { return DriftPerMs * 1.0e6; }
+	uint32 GetNumLate() const { return NumLate; }
+
+private:
+	static constexpr int32 WindowSize = 128;
+	static constexpr int32 MaxSamples = 64;
+	static constexpr int32 MinimaSize = 64;
+
+	struct FObservation
+	{
+		double LocalMs;		// relative to OriginMs
+		double OffsetMs;
+	};
+
+	void UpdateClockModel(double LocalMs, double OffsetMs);
+	double OffsetAt(double LocalMs) const { return BaseOffsetMs + DriftPerMs * (LocalMs - OriginMs); }
+
+	TArray<FSWIHubImuFrame> Samples;	// sorted by TsMs
+
+	TArray<FObservation> Window;		// ring
+	int32 WindowHead = 0;
+	TArray<float> Scratch;
+
+	TArray<FObservation> Minima;		// ring, one per second
+	int32 MinimaHead = 0;
+	FObservation BucketMin{ 0.0, 0.0 };
+	double BucketStartMs = 0.0;
+	bool bHasBucket = false;
+
+	double OriginMs = 0.0;
+	double BaseOffsetMs = 0.0;
+	double DriftPerMs = 0.0;
+	bool bHasClock = false;
+
+	float JitterMs = 0.f;				// RFC 3550 interarrival jitter
+	double LastTransitMs = 0.0;
+	float TargetDelayMs = 0.f;
+	float SendIntervalMs = 0.f;
+
+	double LastPlayMs = 0.0;
+	bool bHasPlayed = false;
+	uint32 NumLate = 0;
+};
@@ -0,0 +1,43 @@
+#include "SWIGyroLookIntegrator.h"
+
+float FSWIGyroLookIntegrator::AdvanceSample(double TsMs, double RecvTimeSec)
+{
+	const double SampleMs = TsMs > 0.0 ? TsMs : RecvTimeSec * 1000.0;
+
+	if (!bHasSample)
+	{
+		LastTsMs = SampleMs;
+		bHasSample = true;
+		return 0.f;
+	}
+
+	const double DeltaMs = SampleMs - LastTsMs;
+	if (DeltaMs <= 0.0)
+	{
+		if (-DeltaMs > ClockResetMs)
+		{
+			LastTsMs = SampleMs;
+			return 0.f;
+		}
+		++NumDropped;
+		return -1.f;
+	}
+
+	LastTsMs = SampleMs;
+	return FMath::Min(static_cast<float>(DeltaMs * 0.001), MaxSampleGapSec);
+}
+
+FVector2D FSWIGyroLookIntegrator::Consume(float DeltaTime, float SmoothingHz)
+{
+	const float Alpha = SmoothingHz > 0.f ? 1.f - FMath::Exp(-SmoothingHz * DeltaTime) : 1.f;
+	const FVector2D Out = Pending * Alpha;
+	Pending -= Out;
+	return Out;
+}
+
+void FSWIGyroLookIntegrator::Reset()
+{
+	Pending = FVector2D::ZeroVector;
+	LastTsMs = 0.0;
+	bHasSample = false;
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Turns one device's timestamped IMU samples into look rotation that does not depend on the render frame time.
+ * Each sample is integrated over its own TsMs interval into a reservoir; the consumer drains the reservoir
+ * every tick with a time-constant release, so the total rotation is the same however the ticks split it.
+ */
+struct SWI_API FSWIGyroLookIntegrator
+{
+	// Longest interval a single sample may integrate over (covers gaps after stalls or packet loss).
+	float MaxSampleGapSec = 0.1f;
+
+	// A timestamp this far behind the last one is treated as a sender clock reset rather than a late packet.
+	double ClockResetMs = 1000.0;
+
+	/**
+	 * Advances the device clock to this sample.
+	 * Returns the interval (sec) the sample covers, 0 for the first sample, or -1 for a duplicate / out-of-order sample
+	 * that must not be integrated. Senders without a timestamp (TsMs <= 0) fall back to local receive time.
+	 */
+	float AdvanceSample(double TsMs, double RecvTimeSec);
+
+	void AddDelta(const FVector2D& DeltaDeg) { Pending += DeltaDeg; }
+
+	// Releases part of the pending rotation for a tick of DeltaTime; SmoothingHz <= 0 releases everything.
+	FVector2D Consume(float DeltaTime, float SmoothingHz);
+
+	void Reset();
+
+	const FVector2D& GetPending() const { return Pending; }
+	uint32 GetNumDroppedSamples() const { return NumDropped; }
+
+private:
+	FVector2D Pending = FVector2D::ZeroVector;
+	double LastTsMs = 0.0;
+	bool bHasSample = false;
+	uint32 NumDropped = 0;
+};
@@ -0,0 +1,60 @@
+#include "SWIGyroLookPredictor.h"
+
+void FSWIGyroLookPredictor::AddSample(const FVector2D& DeltaDeg, float Dt, double RecvTimeSec)
+{
+	LastRecvTimeSec = RecvTimeSec;
+	if (Dt <= 0.f) return;
+
+	const FVector2D Measured = DeltaDeg / Dt;
+	if (!bHasRate)
+	{
+		Rate = Measured;
+		RateVar = RateMeasurementNoise;
+		bHasRate = true;
+		return;
+	}
+
+	RateVar += RateProcessNoise * Dt;
+
+	// What the last forecast would have missed by, in degrees at the horizon it was used with.
+	const FVector2D Innovation = Measured - Rate;
+	ErrorDeg += (static_cast<float>(Innovation.Size()) * HorizonSec - ErrorDeg) * FMath::Min(Dt * 10.f, 1.f);
+
+	const float Gain = RateVar / (RateVar + RateMeasurementNoise);
+	Rate += Innovation * Gain;
+	RateVar *= 1.f - Gain;
+}
+
+FVector2D FSWIGyroLookPredictor::Consume(double NowSec, float DeltaTime, float LatencySec)
+{
+	FVector2D Target = FVector2D::ZeroVector;
+
+	const float AgeSec = static_cast<float>(NowSec - LastRecvTimeSec);
+	if (bHasRate && AgeSec >= 0.f && AgeSec < MaxHorizonSec + 0.1f)
+	{
+		HorizonSec = FMath::Clamp(AgeSec + LatencySec, 0.f, MaxHorizonSec);
+		Target = Rate * HorizonSec;
+
+		if (ErrorDeg > MaxErrorDeg)
+		{
+			Target *= MaxErrorDeg / ErrorDeg;
+		}
+	}
+	// Stream stalled: give the lead back rather than keep turning on a stale rate.
+
+	const float Alpha = LeadSmoothingHz > 0.f ? 1.f - FMath::Exp(-LeadSmoothingHz * DeltaTime) : 1.f;
+	const FVector2D Prev = Lead;
+	Lead += (Target - Lead) * Alpha;
+	return Lead - Prev;
+}
+
+void FSWIGyroLookPredictor::Reset()
+{
+	Rate = FVector2D::ZeroVector;
+	RateVar = 0.f;
+	bHasRate = false;
+	Lead = FVector2D::ZeroVector;
+	ErrorDeg = 0.f;
+	HorizonSec = 0.f;
+	LastRecvTimeSec = 0.0;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Forecasts look rotation past the pipeline latency (network + sample age + release smoothing).
+ *
+ * A per-axis constant-velocity Kalman filter tracks the look rate from the same scaled deltas fed to the integrator.
+ * The consumer adds a "lead" of Rate * Horizon on top of the released rotation and returns it as a delta, so the lead
+ * is given back as soon as the rate falls and the long-run total stays exact. Innovations scaled by the horizon give a
+ * running prediction error; above MaxErrorDeg the lead is scaled down instead of amplifying noise.
+ */
+struct SWI_API FSWIGyroLookPredictor
+{
+	// Rate random walk ((deg/s)^2 per s) and rate measurement noise ((deg/s)^2).
+	float RateProcessNoise = 4000.f;
+	float RateMeasurementNoise = 400.f;
+
+	float MaxHorizonSec = 0.1f;
+	float MaxErrorDeg = 3.f;
+
+	// How quickly the applied lead follows its target; keeps the forecast from adding frame-to-frame jitter.
+	float LeadSmoothingHz = 30.f;
+
+	void AddSample(const FVector2D& DeltaDeg, float Dt, double RecvTimeSec);
+
+	/**
+	 * Returns the change of the lead since the last call, to be added to this tick's look delta.
+	 * LatencySec is everything between a sample's arrival and the view (network one-way + release lag);
+	 * the time the newest sample has already waited is added here.
+	 */
+	FVector2D Consume(double NowSec, float DeltaTime, float LatencySec);
+
+	void Reset();
+
+	const FVector2D& GetRate() const { return Rate; }
+	const FVector2D& GetLead() const { return Lead; }
+	float GetErrorDeg() const { return ErrorDeg; }
+	float GetHorizonSec() const { return HorizonSec; }
+
+private:
+	FVector2D Rate = FVector2D::ZeroVector;
+	float RateVar = 0.f;
+	bool bHasRate = false;
+
+	FVector2D Lead = FVector2D::ZeroVector;
+	float ErrorDeg = 0.f;
+	float HorizonSec = 0.f;
+	double LastRecvTimeSec = 0.0;
+};
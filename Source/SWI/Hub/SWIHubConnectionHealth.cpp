@@ -0,0 +1,124 @@
+#include "SWIHubConnectionHealth.h"
+#include "HAL/PlatformTime.h"
+
+FSWIHubConnectionHealth::FSWIHubConnectionHealth()
+	: Rng(static_cast<int32>(FPlatformTime::Cycles()))	// per-process seed, or the jitter would match across clients
+{
+}
+
+void FSWIHubConnectionHealth::SetUrls(TArray<FString>&& InUrls)
+{
+	Urls = MoveTemp(InUrls);
+	UrlIndex = 0;
+	Failures = 0;
+}
+
+const FString& FSWIHubConnectionHealth::GetUrl() const
+{
+	static const FString Empty;
+	return Urls.IsValidIndex(UrlIndex) ? Urls[UrlIndex] : Empty;
+}
+
+void FSWIHubConnectionHealth::NotifyConnected(double Now)
+{
+	bConnected = true;
+	ConnectedSec = Now;
+	NextPingSec = Now;
+	bPongSeen = false;
+	for (FPendingPing& Ping : Pending)
+	{
+		Ping = FPendingPing();
+	}
+}
+
+float FSWIHubConnectionHealth::NotifyConnectionLost(double Now)
+{
+	if (bConnected && Now - ConnectedSec >= StableAfterSec)
+	{
+		Failures = 0;
+	}
+	bConnected = false;
+	bPongSeen = false;
+	++Failures;
+
+	const int32 NumUrls = FMath::Max(Urls.Num(), 1);
+	UrlIndex = (UrlIndex + 1) % NumUrls;
+
+	// Fail over straight away until every URL had its turn in this round.
+	if (Failures % NumUrls != 0)
+	{
+		return FailoverDelaySec;
+	}
+
+	const int32 Round = FMath::Min(Failures / NumUrls - 1, 16);
+	const float Delay = FMath::Min(ReconnectDelaySec * static_cast<float>(1 << Round), MaxReconnectDelaySec);
+	return Delay * (0.5f + 0.5f * Rng.GetFraction());
+}
+
+uint32 FSWIHubConnectionHealth::ConsumePingDue(double Now)
+{
+	if (!bConnected || PingIntervalSec <= 0.f || Now < NextPingSec)
+	{
+		return 0;
+	}
+
+	NextPingSec = Now + PingIntervalSec;
+	const uint32 Id = NextPingId++;
+	if (NextPingId == 0)
+	{
+		NextPingId = 1;
+	}
+	Pending[Id % MaxPendingPings] = FPendingPing{ Id, Now };
+	return Id;
+}
+
+void FSWIHubConnectionHealth::NotifyPong(uint32 Id, double RecvSec)
+{
+	FPendingPing& Ping = Pending[Id % MaxPendingPings];
+	if (Id == 0 || Ping.Id != Id || RecvSec < Ping.SentSec)
+	{
+		return;	// unknown, answered twice, or from a previous connection
+	}
+	Ping.Id = 0;
+
+	LastRttMs = static_cast<float>((RecvSec - Ping.SentSec) * 1000.0);
+	if (!bPongSeen)
+	{
+		SmoothedRttMs = LastRttMs;
+		RttVarMs = LastRttMs * 0.5f;
+		bPongSeen = true;
+		return;
+	}
+	RttVarMs = 0.75f * RttVarMs + 0.25f * FMath::Abs(SmoothedRttMs - LastRttMs);
+	SmoothedRttMs = 0.875f * SmoothedRttMs + 0.125f * LastRttMs;
+}
+
+FSWIHubConnectionHealth::EVerdict FSWIHubConnectionHealth::Evaluate(double Now, double LastInboundSec) const
+{
+	if (!bConnected || !bPongSeen)
+	{
+		return EVerdict::Healthy;
+	}
+
+	const double SilenceSec = Now - FMath::Max(LastInboundSec, ConnectedSec);
+	if (SilenceSec >= DeadSilenceSec)
+	{
+		return EVerdict::Dead;
+	}
+	if (SilenceSec >= DegradedSilenceSec || (DegradedRttMs > 0.f && SmoothedRttMs > DegradedRttMs))
+	{
+		return EVerdict::Degraded;
+	}
+	return EVerdict::Healthy;
+}
+
+void FSWIHubConnectionHealth::Reset()
+{
+	bConnected = false;
+	bPongSeen = false;
+	Failures = 0;
+	UrlIndex = 0;
+	SmoothedRttMs = 0.f;
+	RttVarMs = 0.f;
+	LastRttMs = 0.f;
+}
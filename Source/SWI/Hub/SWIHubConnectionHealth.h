@@ -0,0 +1,88 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+
+/**
+ * Hub socket health: application-level ping / pong RTT, silence detection, and where and when to reconnect.
+ *
+ * A lost connection fails over to the next hub URL after FailoverDelaySec. Only once every URL failed in a row does
+ * the delay grow, ReconnectDelaySec * 2^round up to MaxReconnectDelaySec, with equal jitter so clients that lost the
+ * same AP do not retry in lockstep. Silence only counts against hubs that answered a ping on this connection
+ * (older hubs are still covered by the socket's close event). Game thread.
+ */
+class SWI_API FSWIHubConnectionHealth
+{
+public:
+	enum class EVerdict : uint8
+	{
+		Healthy,
+		Degraded,	// no traffic for DegradedSilenceSec, or smoothed RTT above DegradedRttMs
+		Dead,		// no traffic for DeadSilenceSec: drop the socket and reconnect
+	};
+
+	float PingIntervalSec = 1.f;		// 0 = no pings
+	float DegradedSilenceSec = 2.f;
+	float DeadSilenceSec = 5.f;
+	float DegradedRttMs = 150.f;		// 0 = RTT never degrades
+	float FailoverDelaySec = 0.1f;
+	float ReconnectDelaySec = 1.f;
+	float MaxReconnectDelaySec = 30.f;
+
+	// A connection that lived this long resets the backoff when it drops.
+	float StableAfterSec = 10.f;
+
+	FSWIHubConnectionHealth();
+
+	void SetUrls(TArray<FString>&& InUrls);
+	const FString& GetUrl() const;
+	int32 GetNumUrls() const { return Urls.Num(); }
+
+	void NotifyConnected(double Now);
+
+	// Picks the URL for the next attempt and returns how long to wait before it.
+	float NotifyConnectionLost(double Now);
+
+	// Id of a ping to send now, or 0.
+	uint32 ConsumePingDue(double Now);
+	void NotifyPong(uint32 Id, double RecvSec);
+
+	EVerdict Evaluate(double Now, double LastInboundSec) const;
+
+	void Reset();
+
+	bool IsConnected() const { return bConnected; }
+	bool HasPongSupport() const { return bPongSeen; }
+	int32 GetConsecutiveFailures() const { return Failures; }
+
+	// RFC 6298 smoothed RTT and mean deviation.
+	float GetRttMs() const { return SmoothedRttMs; }
+	float GetRttVarMs() const { return RttVarMs; }
+	float GetLastRttMs() const { return LastRttMs; }
+
+private:
+	static constexpr int32 MaxPendingPings = 8;
+
+	struct FPendingPing
+	{
+		uint32 Id = 0;
+		double SentSec = 0.0;
+	};
+
+	TArray<FString> Urls;
+	int32 UrlIndex = 0;
+	int32 Failures = 0;
+	bool bConnected = false;
+	double ConnectedSec = 0.0;
+
+	FPendingPing Pending[MaxPendingPings];
+	uint32 NextPingId = 1;
+	double NextPingSec = 0.0;
+
+	bool bPongSeen = false;
+	float SmoothedRttMs = 0.f;
+	float RttVarMs = 0.f;
+	float LastRttMs = 0.f;
+
+	FRandomStream Rng;
+};
@@ -0,0 +1,87 @@
+#include "SWIHubDeviceHandles.h"
+
+int32 FSWIHubDeviceHandles::Find(FStringView Uid) const
+{
+	// FStringView hashes like FString, so known uids are found without building a key.
+	const int32* Found = HandleByUid.FindByHash(GetTypeHash(Uid), Uid);
+	return Found ? *Found : INDEX_NONE;
+}
+
+int32 FSWIHubDeviceHandles::Add(FStringView Uid)
+{
+	const int32 Handle = Entries.AddDefaulted();
+	FEntry& Entry = Entries[Handle];
+	Entry.Identity.Uid = FString(Uid);
+	Entry.Revision = 1;	// never 0, so a zero-initialised cache always refreshes
+	HandleByUid.Add(Entry.Identity.Uid, Handle);
+	return Handle;
+}
+
+int32 FSWIHubDeviceHandles::Intern(FStringView Uid, FStringView Name, FStringView MatchId)
+{
+	if (Uid.IsEmpty()) return INDEX_NONE;
+
+	int32 Handle = Find(Uid);
+	if (Handle == INDEX_NONE)
+	{
+		Handle = Add(Uid);
+	}
+
+	FSWIHubDeviceIdentity& Identity = Entries[Handle].Identity;
+	const bool bNameChanged = !Name.IsEmpty() && !FStringView(Identity.Name).Equals(Name, ESearchCase::CaseSensitive);
+	const bool bMatchChanged = !FStringView(Identity.MatchId).Equals(MatchId, ESearchCase::CaseSensitive);
+	if (bNameChanged || bMatchChanged)
+	{
+		if (bNameChanged) Identity.Name = FString(Name);
+		if (bMatchChanged) Identity.MatchId = FString(MatchId);
+		++Entries[Handle].Revision;
+	}
+	return Handle;
+}
+
+int32 FSWIHubDeviceHandles::InternUid(FStringView Uid, FStringView Name)
+{
+	if (Uid.IsEmpty()) return INDEX_NONE;
+
+	int32 Handle = Find(Uid);
+	if (Handle == INDEX_NONE)
+	{
+		Handle = Add(Uid);
+	}
+
+	FEntry& Entry = Entries[Handle];
+	if (!Name.IsEmpty() && !FStringView(Entry.Identity.Name).Equals(Name, ESearchCase::CaseSensitive))
+	{
+		Entry.Identity.Name = FString(Name);
+		++Entry.Revision;
+	}
+	return Handle;
+}
+
+bool FSWIHubDeviceHandles::Resolve(int32 Handle, FSWIHubDeviceIdentity& Out) const
+{
+	if (!Entries.IsValidIndex(Handle)) return false;
+
+	Out = Entries[Handle].Identity;
+	return true;
+}
+
+FString FSWIHubDeviceHandles::GetUid(int32 Handle) const
+{
+	return Entries.IsValidIndex(Handle) ? Entries[Handle].Identity.Uid : FString();
+}
+
+FString FSWIHubDeviceHandles::GetName(int32 Handle) const
+{
+	return Entries.IsValidIndex(Handle) ? Entries[Handle].Identity.Name : FString();
+}
+
+FString FSWIHubDeviceHandles::GetMatchId(int32 Handle) const
+{
+	return Entries.IsValidIndex(Handle) ? Entries[Handle].Identity.MatchId : FString();
+}
+
+uint32 FSWIHubDeviceHandles::GetRevision(int32 Handle) const
+{
+	return Entries.IsValidIndex(Handle) ? Entries[Handle].Revision : 0;
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FSWIHubDeviceIdentity
+{
+	FString Uid;
+	FString Name;
+	FString MatchId;
+};
+
+/**
+ * Interns device uids into dense int32 handles, so IMU frames carry a handle instead of three strings.
+ *
+ * A handle is assigned the first time a uid is seen (device_connected, device_index, a frame or a route binding) and
+ * stays valid for the lifetime of the table; a phone that reconnects gets its old handle back. Interning a known
+ * identity is a hash lookup on the caller's string views and allocates nothing; only a new uid, name or match id
+ * does. Revision changes whenever a device's name or match id does, so consumers can cache what they resolved.
+ * Game thread.
+ */
+class SWI_API FSWIHubDeviceHandles
+{
+public:
+	// Frame / device_index identity: MatchId is authoritative (empty = not in a match), an empty Name keeps the known one.
+	int32 Intern(FStringView Uid, FStringView Name, FStringView MatchId);
+	int32 Intern(const FSWIHubDeviceIdentity& Identity) { return Intern(Identity.Uid, Identity.Name, Identity.MatchId); }
+
+	// Uid (and optionally name) without touching the match id: device_connected, route bindings.
+	int32 InternUid(FStringView Uid, FStringView Name = FStringView());
+
+	// INDEX_NONE when the uid was never seen.
+	int32 Find(FStringView Uid) const;
+
+	bool Resolve(int32 Handle, FSWIHubDeviceIdentity& Out) const;
+	FString GetUid(int32 Handle) const;
+	FString GetName(int32 Handle) const;
+	FString GetMatchId(int32 Handle) const;
+	uint32 GetRevision(int32 Handle) const;
+
+	int32 Num() const { return Entries.Num(); }
+
+private:
+	struct FEntry
+	{
+		FSWIHubDeviceIdentity Identity;
+		uint32 Revision = 0;
+	};
+
+	int32 Add(FStringView Uid);
+
+	TMap<FString, int32> HandleByUid;
+	TArray<FEntry> Entries;
+};
@@ -0,0 +1,82 @@
+#include "SWIHubDeviceRegistry.h"
+
+FSWIHubDeviceRegistry::EApply FSWIHubDeviceRegistry::Advance(int64 DeltaVersion)
+{
+	if (DeltaVersion <= 0)
+	{
+		return EApply::Applied;	// unversioned hub
+	}
+	if (DeltaVersion <= Version)
+	{
+		return EApply::Stale;
+	}
+
+	const bool bGap = bHasSnapshot && DeltaVersion != Version + 1;
+	Version = DeltaVersion;
+	return bGap || !bHasSnapshot ? EApply::Gap : EApply::Applied;
+}
+
+FSWIHubDeviceRegistry::EApply FSWIHubDeviceRegistry::ApplyConnected(const FSWIHubDeviceInfo& Device, int64 DeltaVersion)
+{
+	const EApply Result = Advance(DeltaVersion);
+	if (Result == EApply::Stale || Device.Uid.IsEmpty())
+	{
+		return Result;
+	}
+
+	// Deltas are idempotent per uid, so one applied across a gap is still correct.
+	if (const FSWIHubDeviceInfo* Old = Devices.Find(Device.Uid))
+	{
+		PhoneCount -= IsPhone(*Old) ? 1 : 0;
+	}
+	Devices.Add(Device.Uid, Device);
+	PhoneCount += IsPhone(Device) ? 1 : 0;
+	return Result;
+}
+
+FSWIHubDeviceRegistry::EApply FSWIHubDeviceRegistry::ApplyDisconnected(const FString& Uid, int64 DeltaVersion)
+{
+	const EApply Result = Advance(DeltaVersion);
+	if (Result == EApply::Stale)
+	{
+		return Result;
+	}
+
+	FSWIHubDeviceInfo Removed;
+	if (Devices.RemoveAndCopyValue(Uid, Removed))
+	{
+		PhoneCount -= IsPhone(Removed) ? 1 : 0;
+	}
+	return Result;
+}
+
+void FSWIHubDeviceRegistry::ApplySnapshot(TArray<FSWIHubDeviceInfo>&& InDevices, int64 SnapshotVersion)
+{
+	Devices.Reset();
+	for (FSWIHubDeviceInfo& Device : InDevices)
+	{
+		if (!Device.Uid.IsEmpty())
+		{
+			const FString Uid = Device.Uid;
+			Devices.Add(Uid, MoveTemp(Device));
+		}
+	}
+
+	PhoneCount = 0;
+	for (const TPair<FString, FSWIHubDeviceInfo>& Pair : Devices)
+	{
+		PhoneCount += IsPhone(Pair.Value) ? 1 : 0;
+	}
+
+	// The hub may have restarted, so its version can go backwards.
+	Version = SnapshotVersion;
+	bHasSnapshot = true;
+}
+
+void FSWIHubDeviceRegistry::Reset()
+{
+	Devices.Reset();
+	PhoneCount = 0;
+	Version = 0;
+	bHasSnapshot = false;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SWI/SWIHubProtocolTypes.h"
+
+/**
+ * Devices connected to the hub, kept from the pushed device_connected / device_disconnected deltas instead of
+ * re-reading the whole list. The hub stamps every delta and device_list with a list version ("ver"):
+ * a delta one past the current version applies in place, an older one is already part of the list, and a jump
+ * means deltas were missed, so the caller asks for a full device_list (ApplySnapshot). Hubs without "ver" (0)
+ * are applied as they come. Lookups and the phone count are O(1). Game thread.
+ */
+class SWI_API FSWIHubDeviceRegistry
+{
+public:
+	enum class EApply : uint8
+	{
+		Applied,
+		Stale,		// older than the list (already included)
+		Gap,		// applied, but deltas before it were missed: resync
+	};
+
+	EApply ApplyConnected(const FSWIHubDeviceInfo& Device, int64 Version);
+	EApply ApplyDisconnected(const FString& Uid, int64 Version);
+	void ApplySnapshot(TArray<FSWIHubDeviceInfo>&& InDevices, int64 Version);
+	void Reset();
+
+	const FSWIHubDeviceInfo* Find(const FString& Uid) const { return Devices.Find(Uid); }
+	int32 Num() const { return Devices.Num(); }
+	int32 NumPhones() const { return PhoneCount; }
+
+	int64 GetVersion() const { return Version; }
+	bool HasSnapshot() const { return bHasSnapshot; }
+
+	const TMap<FString, FSWIHubDeviceInfo>& GetDevices() const { return Devices; }
+
+private:
+	EApply Advance(int64 DeltaVersion);
+	static bool IsPhone(const FSWIHubDeviceInfo& Device) { return Device.Role.Equals(TEXT("phone"), ESearchCase::IgnoreCase); }
+
+	TMap<FString, FSWIHubDeviceInfo> Devices;
+	int32 PhoneCount = 0;
+	int64 Version = 0;
+	bool bHasSnapshot = false;
+};
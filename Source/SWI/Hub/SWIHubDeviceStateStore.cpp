@@ -0,0 +1,114 @@
+#include "SWIHubDeviceStateStore.h"
+
+void FSWIHubDeviceStateBuffer::SetNum(int32 NewNum)
+{
+	TsMs.SetNumZeroed(NewNum);
+	RecvTimeSec.SetNumZeroed(NewNum);
+	Euler.SetNumZeroed(NewNum);
+	Accel.SetNumZeroed(NewNum);
+	Gyro.SetNumZeroed(NewNum);
+	Buttons.SetNumZeroed(NewNum);
+	Seq.SetNumZeroed(NewNum);
+	FrameCount.SetNumZeroed(NewNum);
+}
+
+void FSWIHubDeviceStateBuffer::CopyRow(const FSWIHubDeviceStateBuffer& From, int32 Row)
+{
+	TsMs[Row] = From.TsMs[Row];
+	RecvTimeSec[Row] = From.RecvTimeSec[Row];
+	Euler[Row] = From.Euler[Row];
+	Accel[Row] = From.Accel[Row];
+	Gyro[Row] = From.Gyro[Row];
+	Buttons[Row] = From.Buttons[Row];
+	Seq[Row] = From.Seq[Row];
+	FrameCount[Row] = From.FrameCount[Row];
+}
+
+void FSWIHubDeviceStateBuffer::Reset()
+{
+	SetNum(0);
+}
+
+void FSWIHubDeviceStateStore::BeginBatch()
+{
+	if (bInBatch) return;
+	bInBatch = true;
+
+	const int32 Front = FrontIndex.load(std::memory_order_relaxed);
+	const FSWIHubDeviceStateBuffer& Published = Buffers[Front];
+	FSWIHubDeviceStateBuffer& Back = Buffers[1 - Front];
+
+	// Only rows touched by the last publish differ between the two buffers.
+	Back.SetNum(FMath::Max(Back.Num(), Published.Num()));
+	for (const int32 Row : PendingSync)
+	{
+		Back.CopyRow(Published, Row);
+	}
+	PendingSync.Reset();
+}
+
+void FSWIHubDeviceStateStore::Write(int32 Index, const FSWIHubImuFrame& Frame, double RecvTimeSec)
+{
+	if (Index < 0) return;
+	BeginBatch();
+
+	FSWIHubDeviceStateBuffer& Back = Buffers[1 - FrontIndex.load(std::memory_order_relaxed)];
+	if (Index >= Back.Num())
+	{
+		Back.SetNum(Index + 1);
+	}
+
+	Back.TsMs[Index] = Frame.TsMs;
+	Back.RecvTimeSec[Index] = RecvTimeSec;
+	Back.Euler[Index] = FVector3f(Frame.Yaw, Frame.Pitch, Frame.Roll);
+	Back.Accel[Index] = FVector3f(Frame.Ax, Frame.Ay, Frame.Az);
+	Back.Gyro[Index] = FVector3f(Frame.Gx, Frame.Gy, Frame.Gz);
+	Back.Buttons[Index] = Frame.Buttons;
+	Back.Seq[Index] = Frame.Seq;
+	if (Back.FrameCount[Index]++ == 0)
+	{
+		++NumSeen;
+	}
+
+	if (Index >= DirtyRows.Num())
+	{
+		DirtyRows.Add(false, Index + 1 - DirtyRows.Num());
+	}
+	if (!DirtyRows[Index])
+	{
+		DirtyRows[Index] = true;
+		DirtyList.Add(Index);
+	}
+}
+
+void FSWIHubDeviceStateStore::Publish()
+{
+	if (!bInBatch) return;
+	bInBatch = false;
+
+	const int32 Back = 1 - FrontIndex.load(std::memory_order_relaxed);
+	FrontIndex.store(Back, std::memory_order_release);
+
+	// The old front becomes the next back buffer; it is brought up to date lazily in BeginBatch
+	// so snapshots taken this tick are not overwritten under their readers.
+	for (const int32 Row : DirtyList)
+	{
+		DirtyRows[Row] = false;
+	}
+	PendingSync = MoveTemp(DirtyList);
+	DirtyList.Reset();
+}
+
+void FSWIHubDeviceStateStore::Reset()
+{
+	Buffers[0].Reset();
+	Buffers[1].Reset();
+	FrontIndex.store(0, std::memory_order_release);
+
+	NumSeen = 0;
+
+	DirtyRows.Empty();
+	DirtyList.Reset();
+	PendingSync.Reset();
+	bInBatch = false;
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SWI/SWIHubProtocolTypes.h"
+#include <atomic>
+
+/**
+ * Latest IMU sample per device, structure-of-arrays keyed by the dense device handle (FSWIHubDeviceHandles).
+ * Every column has the same length; row i is device i. Rows of devices that sent nothing yet have FrameCount 0.
+ */
+struct SWI_API FSWIHubDeviceStateBuffer
+{
+	TArray<double> TsMs;
+	TArray<double> RecvTimeSec;
+	TArray<FVector3f> Euler;	// yaw, pitch, roll (deg)
+	TArray<FVector3f> Accel;
+	TArray<FVector3f> Gyro;
+	TArray<int32> Buttons;		// level bitmask, bit 0 = fire
+	TArray<int64> Seq;
+	TArray<uint32> FrameCount;
+
+	int32 Num() const { return TsMs.Num(); }
+
+	void SetNum(int32 NewNum);
+	void CopyRow(const FSWIHubDeviceStateBuffer& From, int32 Row);
+	void Reset();
+};
+
+/**
+ * Double-buffered device state table.
+ * One writer fills the back buffer and Publish() flips it to the front with a single atomic store,
+ * so readers never lock and always see a table that was complete at publish time.
+ * A snapshot stays intact until the writer's next batch starts (the following tick's drain).
+ */
+class SWI_API FSWIHubDeviceStateStore
+{
+public:
+	// Writer side. Index is the frame's device handle.
+	void Write(int32 Index, const FSWIHubImuFrame& Frame, double RecvTimeSec);
+	void Publish();
+	void Reset();
+
+	// Reader side
+	const FSWIHubDeviceStateBuffer& GetSnapshot() const { return Buffers[FrontIndex.load(std::memory_order_acquire)]; }
+
+	// Devices that wrote at least one frame since Reset(). Writer-owned.
+	int32 NumDevices() const { return NumSeen; }
+
+private:
+	void BeginBatch();
+
+	FSWIHubDeviceStateBuffer Buffers[2];
+	std::atomic<int32> FrontIndex{ 0 };
+
+	int32 NumSeen = 0;
+
+	// Rows written in the current batch, and rows the back buffer still has to catch up on.
+	TBitArray<> DirtyRows;
+	TArray<int32> DirtyList;
+	TArray<int32> PendingSync;
+	bool bInBatch = false;
+};
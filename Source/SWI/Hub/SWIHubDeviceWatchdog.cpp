@@ -0,0 +1,103 @@
+#include "SWIHubDeviceWatchdog.h"
+
+void FSWIHubDeviceWatchdog::Schedule(int32 Device, FWatch& W, double DeadlineSec)
+{
+	W.QueuedSec = DeadlineSec;
+	W.bQueued = true;
+	Deadlines.HeapPush(FDeadline{ DeadlineSec, Device });
+}
+
+void FSWIHubDeviceWatchdog::Watch(int32 Device, float TimeoutSec, double NowSec)
+{
+	if (Device < 0 || TimeoutSec <= 0.f) return;
+
+	if (Watches.Num() <= Device)
+	{
+		Watches.SetNum(Device + 1);
+	}
+
+	FWatch& W = Watches[Device];
+	++W.Watchers;
+	W.TimeoutSec = TimeoutSec;
+	W.LastSeenSec = NowSec;
+	W.bLive = true;
+
+	// A queued deadline later than the new one would fire late; the old entry dies when this one replaces QueuedSec.
+	const double DeadlineSec = NowSec + TimeoutSec;
+	if (!W.bQueued || DeadlineSec < W.QueuedSec)
+	{
+		Schedule(Device, W, DeadlineSec);
+	}
+}
+
+void FSWIHubDeviceWatchdog::Unwatch(int32 Device)
+{
+	if (!Watches.IsValidIndex(Device) || Watches[Device].Watchers == 0) return;
+
+	FWatch& W = Watches[Device];
+	if (--W.Watchers == 0)
+	{
+		// The heap entry stays behind and is skipped when it comes due.
+		W = FWatch();
+	}
+}
+
+void FSWIHubDeviceWatchdog::Touch(int32 Device, double NowSec)
+{
+	if (!Watches.IsValidIndex(Device)) return;
+
+	FWatch& W = Watches[Device];
+	if (W.Watchers == 0) return;
+
+	W.LastSeenSec = NowSec;
+	W.bLive = true;
+	if (!W.bQueued)
+	{
+		Schedule(Device, W, NowSec + W.TimeoutSec);
+	}
+}
+
+void FSWIHubDeviceWatchdog::Tick(double NowSec, TFunctionRef<void(int32 Device)> OnStale)
+{
+	while (Deadlines.Num() > 0 && Deadlines.HeapTop().Sec <= NowSec)
+	{
+		FDeadline Due;
+		Deadlines.HeapPop(Due, EAllowShrinking::No);
+
+		FWatch& W = Watches[Due.Device];
+		if (!W.bQueued || W.QueuedSec != Due.Sec) continue;
+		W.bQueued = false;
+
+		// Seen since this entry was queued: push it back instead of firing.
+		const double DeadlineSec = W.LastSeenSec + W.TimeoutSec;
+		if (DeadlineSec > NowSec)
+		{
+			Schedule(Due.Device, W, DeadlineSec);
+			continue;
+		}
+
+		W.bLive = false;
+		OnStale(Due.Device);
+	}
+}
+
+void FSWIHubDeviceWatchdog::ExpireAll(TFunctionRef<void(int32 Device)> OnStale)
+{
+	Deadlines.Reset();
+	for (int32 Device = 0; Device < Watches.Num(); ++Device)
+	{
+		FWatch& W = Watches[Device];
+		W.bQueued = false;
+		if (W.bLive)
+		{
+			W.bLive = false;
+			OnStale(Device);
+		}
+	}
+}
+
+void FSWIHubDeviceWatchdog::Reset()
+{
+	Watches.Reset();
+	Deadlines.Reset();
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Per-device "last seen" deadlines in one min-heap, so IMU timeouts cost nothing until a device actually goes quiet.
+ *
+ * Touch only stamps the time; a device has at most one live heap entry, and when that entry comes due with newer
+ * traffic behind it, it is pushed back to the new deadline instead of firing. A steady stream therefore costs one
+ * heap operation per timeout period per device, and a Tick with nothing due is a single comparison. A stale device
+ * fires once and re-arms on its next frame. Devices are the hub's dense handles; game thread.
+ */
+class SWI_API FSWIHubDeviceWatchdog
+{
+public:
+	// Arms the device as if it had just been seen. Watchers share the device's timeout; the last Watch sets it.
+	void Watch(int32 Device, float TimeoutSec, double NowSec);
+	void Unwatch(int32 Device);
+
+	// A frame from the device arrived. Unwatched devices are ignored.
+	void Touch(int32 Device, double NowSec);
+
+	// Fires OnStale for every watched device whose deadline passed since its last frame.
+	void Tick(double NowSec, TFunctionRef<void(int32 Device)> OnStale);
+
+	// Fires OnStale for every live device now (the hub stopped, so no frame will come).
+	void ExpireAll(TFunctionRef<void(int32 Device)> OnStale);
+
+	void Reset();
+
+	bool HasPending() const { return Deadlines.Num() > 0; }
+	double GetNextDeadlineSec() const { return Deadlines.Num() > 0 ? Deadlines.HeapTop().Sec : 0.0; }
+	bool IsLive(int32 Device) const { return Watches.IsValidIndex(Device) && Watches[Device].bLive; }
+
+private:
+	struct FWatch
+	{
+		double LastSeenSec = 0.0;
+		double QueuedSec = 0.0;		// deadline of the device's live heap entry
+		float TimeoutSec = 0.f;
+		int32 Watchers = 0;
+		bool bQueued = false;
+		bool bLive = false;
+	};
+
+	struct FDeadline
+	{
+		double Sec = 0.0;
+		int32 Device = INDEX_NONE;
+
+		bool operator<(const FDeadline& Other) const { return Sec < Other.Sec; }
+	};
+
+	void Schedule(int32 Device, FWatch& W, double DeadlineSec);
+
+	TArray<FWatch> Watches;		// by device handle
+	TArray<FDeadline> Deadlines;	// min-heap; entries not matching their device's QueuedSec are dead
+};
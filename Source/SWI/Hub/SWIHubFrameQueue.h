@@ -0,0 +1,65 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Templates/UniquePtr.h"
+
+/**
+ * Bounded FIFO ring between the socket callbacks and the once-per-tick drain. Game thread.
+ * Nothing is allocated after Reset: a push into a full ring fails and the caller counts the drop.
+ */
+template<typename T>
+class TSWIHubBoundedQueue
+{
+public:
+	explicit TSWIHubBoundedQueue(uint32 InCapacity = 1024)
+	{
+		Reset(InCapacity);
+	}
+
+	TSWIHubBoundedQueue(const TSWIHubBoundedQueue&) = delete;
+	TSWIHubBoundedQueue& operator=(const TSWIHubBoundedQueue&) = delete;
+
+	// Drops anything queued.
+	void Reset(uint32 InCapacity)
+	{
+		const uint32 Capacity = FMath::RoundUpToPowerOfTwo(FMath::Max<uint32>(InCapacity, 2));
+		Mask = Capacity - 1;
+		Items = MakeUnique<T[]>(Capacity);
+		Head = 0;
+		Count = 0;
+	}
+
+	bool TryPush(T&& Item)
+	{
+		if (Count > Mask)
+		{
+			return false; // full
+		}
+
+		Items[(Head + Count) & Mask] = MoveTemp(Item);
+		++Count;
+		return true;
+	}
+
+	bool TryPop(T& Out)
+	{
+		if (Count == 0)
+		{
+			return false; // empty
+		}
+
+		Out = MoveTemp(Items[Head]);
+		Head = (Head + 1) & Mask;
+		--Count;
+		return true;
+	}
+
+	uint32 Capacity() const { return Mask + 1; }
+	uint32 Num() const { return Count; }
+
+private:
+	TUniquePtr<T[]> Items;
+	uint32 Mask = 0;
+	uint32 Head = 0;
+	uint32 Count = 0;
+};
@@ -0,0 +1,152 @@
+#include "SWIHubImuCoalescer.h"
+
+void FSWIHubImuCoalescer::Add(int32 Device, FSWIHubImuFrame&& Frame)
+{
+	if (Devices.Num() <= Device)
+	{
+		Devices.SetNum(Device + 1);
+	}
+
+	FDeviceBatch& Batch = Devices[Device];
+	if (!Batch.bActive)
+	{
+		Batch.bActive = true;
+		Batch.bFolding = false;
+		Batch.Held.Reset();
+		Batch.Segments.Reset();
+		Batch.RateTimeSum = FVector3d::ZeroVector;
+		Batch.SpanMs = 0.0;
+		Batch.NumSamples = 0;
+		Batch.LastTsMs = Batch.LastDeliveredTsMs;
+		ActiveDevices.Add(Device);
+	}
+
+	if (!Batch.bFolding)
+	{
+		if (Batch.Held.Num() < MaxUncoalesced)
+		{
+			Batch.Held.Add(MoveTemp(Frame));
+			return;
+		}
+
+		// Backlog: from here this device delivers one frame for the tick.
+		Batch.bFolding = true;
+		for (FSWIHubImuFrame& Held : Batch.Held)
+		{
+			Fold(Batch, MoveTemp(Held));
+		}
+		Batch.Held.Reset();
+	}
+
+	Fold(Batch, MoveTemp(Frame));
+}
+
+void FSWIHubImuCoalescer::Fold(FDeviceBatch& Batch, FSWIHubImuFrame&& Frame)
+{
+	const double Ms = SampleMs(Frame);
+	double DeltaMs = 0.0;
+	bool bClockReset = false;
+	if (Batch.LastTsMs > 0.0)
+	{
+		DeltaMs = Ms - Batch.LastTsMs;
+		bClockReset = -DeltaMs > ClockResetMs;
+		if (DeltaMs <= 0.0 && !bClockReset)
+		{
+			// Duplicate or out of order: the receiver would drop it too.
+			return;
+		}
+	}
+
+	// A button edge ends the run so far and is delivered as its own frame, keeping its exact TsMs and Seq.
+	const bool bEdge = Frame.Buttons != Batch.LastButtons;
+	Batch.LastButtons = Frame.Buttons;
+	if (bEdge && Batch.NumSamples > 0)
+	{
+		CloseSegment(Batch, Batch.Segments);
+	}
+
+	if (bClockReset)
+	{
+		Batch.RateTimeSum = FVector3d::ZeroVector;
+		Batch.SpanMs = 0.0;
+	}
+	else if (DeltaMs > 0.0)
+	{
+		Batch.RateTimeSum += FVector3d(Frame.Gx, Frame.Gy, Frame.Gz) * DeltaMs;
+		Batch.SpanMs += DeltaMs;
+	}
+
+	Batch.LastTsMs = Ms;
+	Batch.Newest = MoveTemp(Frame);
+	++Batch.NumSamples;
+
+	if (bEdge)
+	{
+		CloseSegment(Batch, Batch.Segments);
+	}
+}
+
+void FSWIHubImuCoalescer::CloseSegment(FDeviceBatch& Batch, TArray<FSWIHubImuFrame>& Out)
+{
+	FSWIHubImuFrame& Folded = Out.Emplace_GetRef(MoveTemp(Batch.Newest));
+	Folded.NumSamples = Batch.NumSamples;
+	if (Batch.SpanMs > 0.0)
+	{
+		const FVector3d MeanRate = Batch.RateTimeSum / Batch.SpanMs;
+		Folded.Gx = static_cast<float>(MeanRate.X);
+		Folded.Gy = static_cast<float>(MeanRate.Y);
+		Folded.Gz = static_cast<float>(MeanRate.Z);
+	}
+
+	NumFolded += Batch.NumSamples - 1;
+	Batch.RateTimeSum = FVector3d::ZeroVector;
+	Batch.SpanMs = 0.0;
+	Batch.NumSamples = 0;
+}
+
+void FSWIHubImuCoalescer::Flush(TFunctionRef<void(const FSWIHubImuFrame&)> Emit)
+{
+	// Handlers may stop the hub (and Reset this) from inside Emit, so nothing below touches a batch after emitting.
+	TArray<int32> Pending = MoveTemp(ActiveDevices);
+	ActiveDevices.Reset();
+
+	TArray<FSWIHubImuFrame> Out;
+	for (const int32 Device : Pending)
+	{
+		if (!Devices.IsValidIndex(Device)) continue;
+
+		FDeviceBatch& Batch = Devices[Device];
+		Batch.bActive = false;
+
+		if (!Batch.bFolding)
+		{
+			for (const FSWIHubImuFrame& Frame : Batch.Held)
+			{
+				Batch.LastDeliveredTsMs = FMath::Max(Batch.LastDeliveredTsMs, SampleMs(Frame));
+				Batch.LastButtons = Frame.Buttons;
+			}
+			Swap(Out, Batch.Held);
+		}
+		else
+		{
+			Swap(Out, Batch.Segments);
+			if (Batch.NumSamples > 0)
+			{
+				CloseSegment(Batch, Out);
+			}
+			Batch.LastDeliveredTsMs = Batch.LastTsMs;
+		}
+
+		for (const FSWIHubImuFrame& Frame : Out)
+		{
+			Emit(Frame);
+		}
+		Out.Reset();
+	}
+}
+
+void FSWIHubImuCoalescer::Reset()
+{
+	Devices.Reset();
+	ActiveDevices.Reset();
+}
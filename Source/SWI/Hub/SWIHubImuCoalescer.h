@@ -0,0 +1,59 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SWI/SWIHubProtocolTypes.h"
+
+/**
+ * Folds the IMU frames one device produced within a tick into a single frame, so a hitch costs one dispatch per
+ * device instead of one per queued packet.
+ *
+ * The folded frame carries the newest orientation, acceleration and Seq, and gyro rates replaced by their
+ * time-weighted mean since the previously delivered frame: integrating it over its TsMs interval gives the same
+ * rotation as integrating every sample. A sample whose buttons differ from the previous one is never folded, so
+ * every press and release reaches the receiver with its own TsMs and Seq. Game thread; devices are the state store's dense indices.
+ */
+class SWI_API FSWIHubImuCoalescer
+{
+public:
+	// A device's frames are delivered one by one while it has at most this many in the tick.
+	int32 MaxUncoalesced = 4;
+
+	// A timestamp this far behind the last one restarts the device's timeline (sender clock reset).
+	double ClockResetMs = 1000.0;
+
+	void Add(int32 Device, FSWIHubImuFrame&& Frame);
+
+	// Emits every device's frames for this tick, in order of each device's first frame.
+	void Flush(TFunctionRef<void(const FSWIHubImuFrame&)> Emit);
+
+	void Reset();
+
+	uint64 GetNumFolded() const { return NumFolded; }
+
+private:
+	struct FDeviceBatch
+	{
+		TArray<FSWIHubImuFrame> Held;
+		TArray<FSWIHubImuFrame> Segments;	// folded runs closed by a button change, oldest first
+		FSWIHubImuFrame Newest;
+		bool bFolding = false;
+
+		FVector3d RateTimeSum = FVector3d::ZeroVector;
+		double SpanMs = 0.0;
+		int32 NumSamples = 0;
+
+		double LastTsMs = 0.0;			// newest sample time folded or delivered
+		double LastDeliveredTsMs = 0.0;
+		int32 LastButtons = 0;			// buttons of the newest sample folded or delivered
+		bool bActive = false;
+	};
+
+	void Fold(FDeviceBatch& Batch, FSWIHubImuFrame&& Frame);
+	void CloseSegment(FDeviceBatch& Batch, TArray<FSWIHubImuFrame>& Out);
+
+	static double SampleMs(const FSWIHubImuFrame& Frame) { return Frame.TsMs > 0.0 ? Frame.TsMs : Frame.RecvTimeSec * 1000.0; }
+
+	TArray<FDeviceBatch> Devices;
+	TArray<int32> ActiveDevices;
+	uint64 NumFolded = 0;
+};
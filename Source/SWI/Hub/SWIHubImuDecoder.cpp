@@ -0,0 +1,760 @@
+#include "SWIHubImuDecoder.h"
+#include "Dom/JsonObject.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+	enum class EImuKey : uint8
+	{
+		Unknown,
+		Type, Uid, Name,
+		MatchIdSnake, MatchIdCamel,
+		TsMsSnake, TsMsCamel, Ts,
+		HubRx, HubTx,
+		Yaw, Pitch, Roll,
+		Ax, Ay, Az,
+		Gx, Gy, Gz,
+		Fire, Seq, Buttons,
+	};
+
+	EImuKey ClassifyKey(FStringView Key)
+	{
+		switch (Key.Len())
+		{
+		case 2:
+			if (Key == TEXTVIEW("ts")) return EImuKey::Ts;
+			if (Key == TEXTVIEW("ax")) return EImuKey::Ax;
+			if (Key == TEXTVIEW("ay")) return EImuKey::Ay;
+			if (Key == TEXTVIEW("az")) return EImuKey::Az;
+			if (Key == TEXTVIEW("gx")) return EImuKey::Gx;
+			if (Key == TEXTVIEW("gy")) return EImuKey::Gy;
+			if (Key == TEXTVIEW("gz")) return EImuKey::Gz;
+			break;
+		case 3:
+			if (Key == TEXTVIEW("uid")) return EImuKey::Uid;
+			if (Key == TEXTVIEW("yaw")) return EImuKey::Yaw;
+			if (Key == TEXTVIEW("seq")) return EImuKey::Seq;
+			break;
+		case 4:
+			if (Key == TEXTVIEW("type")) return EImuKey::Type;
+			if (Key == TEXTVIEW("name")) return EImuKey::Name;
+			if (Key == TEXTVIEW("roll")) return EImuKey::Roll;
+			if (Key == TEXTVIEW("fire")) return EImuKey::Fire;
+			if (Key == TEXTVIEW("tsMs")) return EImuKey::TsMsCamel;
+			break;
+		case 5:
+			if (Key == TEXTVIEW("pitch")) return EImuKey::Pitch;
+			if (Key == TEXTVIEW("ts_ms")) return EImuKey::TsMsSnake;
+			break;
+		case 6:
+			if (Key == TEXTVIEW("hub_rx")) return EImuKey::HubRx;
+			if (Key == TEXTVIEW("hub_tx")) return EImuKey::HubTx;
+			break;
+		case 7:
+			if (Key == TEXTVIEW("matchId")) return EImuKey::MatchIdCamel;
+			if (Key == TEXTVIEW("buttons")) return EImuKey::Buttons;
+			break;
+		case 8:
+			if (Key == TEXTVIEW("match_id")) return EImuKey::MatchIdSnake;
+			break;
+		default:
+			break;
+		}
+		return EImuKey::Unknown;
+	}
+
+	struct FCursor
+	{
+		const TCHAR* P = nullptr;
+		const TCHAR* End = nullptr;
+
+		bool AtEnd() const { return P >= End; }
+
+		void SkipWs()
+		{
+			while (P < End && (*P == TEXT(' ') || *P == TEXT('\t') || *P == TEXT('\n') || *P == TEXT('\r')))
+			{
+				++P;
+			}
+		}
+
+		bool Consume(TCHAR Ch)
+		{
+			SkipWs();
+			if (P < End && *P == Ch)
+			{
+				++P;
+				return true;
+			}
+			return false;
+		}
+	};
+
+	// Contents between the quotes, still escaped.
+	bool ReadRawString(FCursor& C, FStringView& Out, bool& bOutHasEscapes)
+	{
+		C.SkipWs();
+		if (C.AtEnd() || *C.P != TEXT('"')) return false;
+		++C.P;
+
+		const TCHAR* Start = C.P;
+		bOutHasEscapes = false;
+		while (C.P < C.End)
+		{
+			const TCHAR Ch = *C.P;
+			if (Ch == TEXT('"'))
+			{
+				Out = FStringView(Start, static_cast<int32>(C.P - Start));
+				++C.P;
+				return true;
+			}
+			if (Ch == TEXT('\\'))
+			{
+				if (C.End - C.P < 2) return false;
+				bOutHasEscapes = true;
+				C.P += 2;
+				continue;
+			}
+			++C.P;
+		}
+		return false;
+	}
+
+	int32 HexValue(TCHAR Ch)
+	{
+		if (Ch >= TEXT('0') && Ch <= TEXT('9')) return Ch - TEXT('0');
+		if (Ch >= TEXT('a') && Ch <= TEXT('f')) return Ch - TEXT('a') + 10;
+		if (Ch >= TEXT('A') && Ch <= TEXT('F')) return Ch - TEXT('A') + 10;
+		return -1;
+	}
+
+	// Reset() keeps the existing allocation, so steady-state uid/name copies do not allocate.
+	void AssignString(FString& Dst, FStringView Raw, bool bHasEscapes)
+	{
+		Dst.Reset(Raw.Len());
+		if (!bHasEscapes)
+		{
+			Dst.AppendChars(Raw.GetData(), Raw.Len());
+			return;
+		}
+
+		const TCHAR* P = Raw.GetData();
+		const TCHAR* End = P + Raw.Len();
+		while (P < End)
+		{
+			TCHAR Ch = *P++;
+			if (Ch == TEXT('\\') && P < End)
+			{
+				const TCHAR Esc = *P++;
+				switch (Esc)
+				{
+				case TEXT('b'): Ch = TEXT('\b'); break;
+				case TEXT('f'): Ch = TEXT('\f'); break;
+				case TEXT('n'): Ch = TEXT('\n'); break;
+				case TEXT('r'): Ch = TEXT('\r'); break;
+				case TEXT('t'): Ch = TEXT('\t'); break;
+				case TEXT('u'):
+				{
+					uint32 Code = 0;
+					int32 Digits = 0;
+					for (; Digits < 4 && P < End; ++Digits, ++P)
+					{
+						const int32 H = HexValue(*P);
+						if (H < 0) break;
+						Code = (Code << 4) | static_cast<uint32>(H);
+					}
+					Ch = static_cast<TCHAR>(Code);
+					break;
+				}
+				default: Ch = Esc; break; // \" \\ \/
+				}
+			}
+			Dst.AppendChar(Ch);
+		}
+	}
+
+	double Pow10(int32 Exp)
+	{
+		static constexpr double Table[] = {
+			1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+			1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+		};
+		return Exp < static_cast<int32>(UE_ARRAY_COUNT(Table)) ? Table[Exp] : FMath::Pow(10.0, static_cast<double>(Exp));
+	}
+
+	bool IsDigit(TCHAR Ch) { return Ch >= TEXT('0') && Ch <= TEXT('9'); }
+
+	bool ReadNumber(FCursor& C, double& Out)
+	{
+		C.SkipWs();
+		const TCHAR* P = C.P;
+		const TCHAR* End = C.End;
+
+		bool bNeg = false;
+		if (P < End && (*P == TEXT('-') || *P == TEXT('+')))
+		{
+			bNeg = (*P == TEXT('-'));
+			++P;
+		}
+
+		uint64 Mantissa = 0;
+		int32 Exp10 = 0;
+		int32 Digits = 0;
+		constexpr uint64 MantissaLimit = 1000000000000000000ull;
+
+		for (; P < End && IsDigit(*P); ++P, ++Digits)
+		{
+			if (Mantissa < MantissaLimit) Mantissa = Mantissa * 10 + (*P - TEXT('0'));
+			else ++Exp10;
+		}
+		if (P < End && *P == TEXT('.'))
+		{
+			++P;
+			for (; P < End && IsDigit(*P); ++P, ++Digits)
+			{
+				if (Mantissa < MantissaLimit)
+				{
+					Mantissa = Mantissa * 10 + (*P - TEXT('0'));
+					--Exp10;
+				}
+			}
+		}
+		if (Digits == 0) return false;
+
+		if (P < End && (*P == TEXT('e') || *P == TEXT('E')))
+		{
+			++P;
+			bool bExpNeg = false;
+			if (P < End && (*P == TEXT('-') || *P == TEXT('+')))
+			{
+				bExpNeg = (*P == TEXT('-'));
+				++P;
+			}
+			int32 E = 0;
+			for (; P < End && IsDigit(*P); ++P)
+			{
+				E = FMath::Min(E * 10 + (*P - TEXT('0')), 1000);
+			}
+			Exp10 += bExpNeg ? -E : E;
+		}
+
+		double Value = static_cast<double>(Mantissa);
+		Value = Exp10 < 0 ? Value / Pow10(-Exp10) : Value * Pow10(Exp10);
+		Out = bNeg ? -Value : Value;
+		C.P = P;
+		return true;
+	}
+
+	bool MatchLiteral(FCursor& C, FStringView Literal)
+	{
+		if (C.End - C.P < Literal.Len()) return false;
+		if (FStringView(C.P, Literal.Len()) != Literal) return false;
+		C.P += Literal.Len();
+		return true;
+	}
+
+	enum class EScalar : uint8 { Number, True, False, Null, Invalid };
+
+	EScalar ReadScalar(FCursor& C, double& OutNumber)
+	{
+		C.SkipWs();
+		if (C.AtEnd()) return EScalar::Invalid;
+		switch (*C.P)
+		{
+		case TEXT('t'): return MatchLiteral(C, TEXTVIEW("true")) ? EScalar::True : EScalar::Invalid;
+		case TEXT('f'): return MatchLiteral(C, TEXTVIEW("false")) ? EScalar::False : EScalar::Invalid;
+		case TEXT('n'): return MatchLiteral(C, TEXTVIEW("null")) ? EScalar::Null : EScalar::Invalid;
+		default: return ReadNumber(C, OutNumber) ? EScalar::Number : EScalar::Invalid;
+		}
+	}
+
+	bool SkipValue(FCursor& C)
+	{
+		C.SkipWs();
+		if (C.AtEnd()) return false;
+
+		const TCHAR First = *C.P;
+		if (First == TEXT('"'))
+		{
+			FStringView Unused;
+			bool bEsc = false;
+			return ReadRawString(C, Unused, bEsc);
+		}
+
+		if (First == TEXT('{') || First == TEXT('['))
+		{
+			int32 Depth = 0;
+			while (C.P < C.End)
+			{
+				const TCHAR Ch = *C.P;
+				if (Ch == TEXT('"'))
+				{
+					FStringView Unused;
+					bool bEsc = false;
+					if (!ReadRawString(C, Unused, bEsc)) return false;
+					continue;
+				}
+				++C.P;
+				if (Ch == TEXT('{') || Ch == TEXT('[')) ++Depth;
+				else if ((Ch == TEXT('}') || Ch == TEXT(']')) && --Depth == 0) return true;
+			}
+			return false;
+		}
+
+		double Unused = 0.0;
+		return ReadScalar(C, Unused) != EScalar::Invalid;
+	}
+
+	void ResetFrame(FSWIHubImuFrame& Out, FSWIHubDeviceIdentity& OutIdentity)
+	{
+		OutIdentity.MatchId.Reset();
+		OutIdentity.Uid.Reset();
+		OutIdentity.Name.Reset();
+		Out.Device = INDEX_NONE;
+		Out.TsMs = 0.0;
+		Out.HubRxMs = Out.HubTxMs = 0.0;
+		Out.Yaw = Out.Pitch = Out.Roll = 0.f;
+		Out.Ax = Out.Ay = Out.Az = 0.f;
+		Out.Gx = Out.Gy = Out.Gz = 0.f;
+		Out.Seq = 0;
+		Out.Buttons = 0;
+		Out.Fire = 0;
+		Out.NumSamples = 1;
+	}
+
+	float* FloatField(FSWIHubImuFrame& F, EImuKey Key)
+	{
+		switch (Key)
+		{
+		case EImuKey::Yaw:   return &F.Yaw;
+		case EImuKey::Pitch: return &F.Pitch;
+		case EImuKey::Roll:  return &F.Roll;
+		case EImuKey::Ax:    return &F.Ax;
+		case EImuKey::Ay:    return &F.Ay;
+		case EImuKey::Az:    return &F.Az;
+		case EImuKey::Gx:    return &F.Gx;
+		case EImuKey::Gy:    return &F.Gy;
+		case EImuKey::Gz:    return &F.Gz;
+		default:             return nullptr;
+		}
+	}
+}
+
+ESWIHubDecodeResult SWIHubImuDecoder::Decode(FStringView Json, FSWIHubImuFrame& Out, FSWIHubDeviceIdentity& OutIdentity)
+{
+	FCursor C{ Json.GetData(), Json.GetData() + Json.Len() };
+	if (!C.Consume(TEXT('{'))) return ESWIHubDecodeResult::Malformed;
+
+	ResetFrame(Out, OutIdentity);
+
+	// Same precedence as the DOM path: later aliases win.
+	int32 TsRank = 0;
+	int32 MatchIdRank = 0;
+	bool bIsImu = false;
+	bool bHasButtons = false;
+
+	if (C.Consume(TEXT('}'))) return ESWIHubDecodeResult::OtherType;
+
+	for (;;)
+	{
+		FStringView Key;
+		bool bKeyEsc = false;
+		if (!ReadRawString(C, Key, bKeyEsc)) return ESWIHubDecodeResult::Malformed;
+		if (!C.Consume(TEXT(':'))) return ESWIHubDecodeResult::Malformed;
+
+		const EImuKey Field = bKeyEsc ? EImuKey::Unknown : ClassifyKey(Key);
+		switch (Field)
+		{
+		case EImuKey::Type:
+		{
+			FStringView Value;
+			bool bEsc = false;
+			if (!ReadRawString(C, Value, bEsc)) return ESWIHubDecodeResult::Malformed;
+			if (!Value.Equals(TEXTVIEW("imu"), ESearchCase::IgnoreCase)) return ESWIHubDecodeResult::OtherType;
+			bIsImu = true;
+			break;
+		}
+		case EImuKey::Uid:
+		case EImuKey::Name:
+		case EImuKey::MatchIdSnake:
+		case EImuKey::MatchIdCamel:
+		{
+			C.SkipWs();
+			if (C.AtEnd()) return ESWIHubDecodeResult::Malformed;
+			if (*C.P != TEXT('"'))
+			{
+				if (!SkipValue(C)) return ESWIHubDecodeResult::Malformed;
+				break;
+			}
+
+			FStringView Value;
+			bool bEsc = false;
+			if (!ReadRawString(C, Value, bEsc)) return ESWIHubDecodeResult::Malformed;
+
+			if (Field == EImuKey::Uid) AssignString(OutIdentity.Uid, Value, bEsc);
+			else if (Field == EImuKey::Name) AssignString(OutIdentity.Name, Value, bEsc);
+			else
+			{
+				const int32 Rank = (Field == EImuKey::MatchIdCamel) ? 2 : 1;
+				if (Rank >= MatchIdRank)
+				{
+					AssignString(OutIdentity.MatchId, Value, bEsc);
+					MatchIdRank = Rank;
+				}
+			}
+			break;
+		}
+		case EImuKey::TsMsSnake:
+		case EImuKey::TsMsCamel:
+		case EImuKey::Ts:
+		{
+			double Number = 0.0;
+			const EScalar Kind = ReadScalar(C, Number);
+			if (Kind == EScalar::Invalid)
+			{
+				if (!SkipValue(C)) return ESWIHubDecodeResult::Malformed;
+				break;
+			}
+			const int32 Rank = (Field == EImuKey::Ts) ? 3 : (Field == EImuKey::TsMsCamel ? 2 : 1);
+			if (Kind == EScalar::Number && Rank >= TsRank)
+			{
+				Out.TsMs = Number;
+				TsRank = Rank;
+			}
+			break;
+		}
+		case EImuKey::HubRx:
+		case EImuKey::HubTx:
+		{
+			double Number = 0.0;
+			const EScalar Kind = ReadScalar(C, Number);
+			if (Kind == EScalar::Invalid)
+			{
+				if (!SkipValue(C)) return ESWIHubDecodeResult::Malformed;
+				break;
+			}
+			if (Kind == EScalar::Number)
+			{
+				(Field == EImuKey::HubRx ? Out.HubRxMs : Out.HubTxMs) = Number;
+			}
+			break;
+		}
+		case EImuKey::Fire:
+		{
+			double Number = 0.0;
+			const EScalar Kind = ReadScalar(C, Number);
+			if (Kind == EScalar::Invalid)
+			{
+				if (!SkipValue(C)) return ESWIHubDecodeResult::Malformed;
+				break;
+			}
+			if (Kind == EScalar::Number) Out.Fire = static_cast<int32>(Number);
+			else if (Kind == EScalar::True) Out.Fire = 1;
+			else if (Kind == EScalar::False) Out.Fire = 0;
+			break;
+		}
+		case EImuKey::Seq:
+		case EImuKey::Buttons:
+		{
+			double Number = 0.0;
+			const EScalar Kind = ReadScalar(C, Number);
+			if (Kind == EScalar::Invalid)
+			{
+				if (!SkipValue(C)) return ESWIHubDecodeResult::Malformed;
+				break;
+			}
+			if (Kind == EScalar::Number)
+			{
+				if (Field == EImuKey::Seq)
+				{
+					Out.Seq = static_cast<int64>(Number);
+				}
+				else
+				{
+					Out.Buttons = static_cast<int32>(static_cast<uint32>(Number));
+					bHasButtons = true;
+				}
+			}
+			break;
+		}
+		case EImuKey::Unknown:
+		{
+			if (!SkipValue(C)) return ESWIHubDecodeResult::Malformed;
+			break;
+		}
+		default:
+		{
+			double Number = 0.0;
+			const EScalar Kind = ReadScalar(C, Number);
+			if (Kind == EScalar::Invalid)
+			{
+				if (!SkipValue(C)) return ESWIHubDecodeResult::Malformed;
+				break;
+			}
+			if (Kind == EScalar::Number)
+			{
+				*FloatField(Out, Field) = static_cast<float>(Number);
+			}
+			break;
+		}
+		}
+
+		if (C.Consume(TEXT(','))) continue;
+		if (C.Consume(TEXT('}'))) break;
+		return ESWIHubDecodeResult::Malformed;
+	}
+
+	SWIHubImuDecoder::ResolveButtons(Out, bHasButtons);
+	return bIsImu ? ESWIHubDecodeResult::Imu : ESWIHubDecodeResult::OtherType;
+}
+
+namespace
+{
+	static_assert(PLATFORM_LITTLE_ENDIAN, "Binary IMU frames are read in host byte order.");
+
+	template<typename T>
+	T ReadLE(const uint8*& P)
+	{
+		T Value;
+		FMemory::Memcpy(&Value, P, sizeof(T));
+		P += sizeof(T);
+		return Value;
+	}
+}
+
+bool SWIHubImuDecoder::DecodeBinary(TConstArrayView<uint8> Bytes, uint16& OutDeviceIndex, FSWIHubImuFrame& Out)
+{
+	if (Bytes.Num() < SWIHubImuWire::FrameSize) return false;
+
+	const uint8* P = Bytes.GetData();
+	if (ReadLE<uint8>(P) != SWIHubImuWire::Magic) return false;
+
+	const uint8 Version = ReadLE<uint8>(P);
+	int32 Size = 0;
+	switch (Version)
+	{
+	case SWIHubImuWire::Version:			Size = SWIHubImuWire::FrameSize; break;
+	case SWIHubImuWire::VersionHubStamps:	Size = SWIHubImuWire::FrameSizeHubStamps; break;
+	case SWIHubImuWire::VersionSeq:			Size = SWIHubImuWire::FrameSizeSeq; break;
+	default:								return false;
+	}
+	if (Bytes.Num() != Size) return false;
+	const bool bHubStamps = Version >= SWIHubImuWire::VersionHubStamps;
+
+	OutDeviceIndex = ReadLE<uint16>(P);
+	Out.TsMs = ReadLE<double>(P);
+
+	Out.Yaw = ReadLE<float>(P);
+	Out.Pitch = ReadLE<float>(P);
+	Out.Roll = ReadLE<float>(P);
+
+	Out.Ax = ReadLE<float>(P);
+	Out.Ay = ReadLE<float>(P);
+	Out.Az = ReadLE<float>(P);
+
+	Out.Gx = ReadLE<float>(P);
+	Out.Gy = ReadLE<float>(P);
+	Out.Gz = ReadLE<float>(P);
+
+	Out.Buttons = static_cast<int32>(ReadLE<uint32>(P));
+	Out.Fire = (Out.Buttons & SWIHubImuWire::ButtonFire) ? 1 : 0;
+
+	Out.HubRxMs = bHubStamps ? ReadLE<double>(P) : 0.0;
+	Out.HubTxMs = bHubStamps ? ReadLE<double>(P) : 0.0;
+	Out.Seq = Version >= SWIHubImuWire::VersionSeq ? ReadLE<uint32>(P) : 0;
+	Out.NumSamples = 1;
+
+	return true;
+}
+
+bool SWIHubImuDecoder::DecodeFromJsonObject(const TSharedPtr<FJsonObject>& Root, FSWIHubImuFrame& Out, FSWIHubDeviceIdentity& OutIdentity)
+{
+	if (!Root.IsValid()) return false;
+
+	auto TryGetNumberAsFloat = [&Root](const TCHAR* Key, float& Value)
+	{
+		double D = 0.0;
+		if (Root->TryGetNumberField(Key, D))
+		{
+			Value = static_cast<float>(D);
+		}
+	};
+
+	Root->TryGetStringField(TEXT("match_id"), OutIdentity.MatchId);
+	Root->TryGetStringField(TEXT("matchId"), OutIdentity.MatchId);
+	Root->TryGetStringField(TEXT("uid"), OutIdentity.Uid);
+	Root->TryGetStringField(TEXT("name"), OutIdentity.Name);
+
+	double Ts = 0.0;
+	if (Root->TryGetNumberField(TEXT("ts_ms"), Ts)) Out.TsMs = Ts;
+	if (Root->TryGetNumberField(TEXT("tsMs"), Ts))  Out.TsMs = Ts;
+	if (Root->TryGetNumberField(TEXT("ts"), Ts))    Out.TsMs = Ts;
+
+	Root->TryGetNumberField(TEXT("hub_rx"), Out.HubRxMs);
+	Root->TryGetNumberField(TEXT("hub_tx"), Out.HubTxMs);
+
+	TryGetNumberAsFloat(TEXT("yaw"), Out.Yaw);
+	TryGetNumberAsFloat(TEXT("pitch"), Out.Pitch);
+	TryGetNumberAsFloat(TEXT("roll"), Out.Roll);
+
+	TryGetNumberAsFloat(TEXT("ax"), Out.Ax);
+	TryGetNumberAsFloat(TEXT("ay"), Out.Ay);
+	TryGetNumberAsFloat(TEXT("az"), Out.Az);
+
+	TryGetNumberAsFloat(TEXT("gx"), Out.Gx);
+	TryGetNumberAsFloat(TEXT("gy"), Out.Gy);
+	TryGetNumberAsFloat(TEXT("gz"), Out.Gz);
+
+	int32 Fire = 0;
+	Root->TryGetNumberField(TEXT("fire"), Fire);
+	Out.Fire = Fire;
+
+	Root->TryGetNumberField(TEXT("seq"), Out.Seq);
+
+	uint32 Buttons = 0;
+	const bool bHasButtons = Root->TryGetNumberField(TEXT("buttons"), Buttons);
+	Out.Buttons = static_cast<int32>(Buttons);
+	ResolveButtons(Out, bHasButtons);
+
+	return !OutIdentity.Uid.IsEmpty();
+}
+
+void SWIHubImuDecoder::ResolveButtons(FSWIHubImuFrame& Frame, bool bHasButtons)
+{
+	// "buttons" wins when present; legacy senders only have the "fire" level.
+	if (bHasButtons)
+	{
+		Frame.Fire = (Frame.Buttons & SWIHubImuWire::ButtonFire) ? 1 : 0;
+	}
+	else
+	{
+		Frame.Buttons = Frame.Fire ? static_cast<int32>(SWIHubImuWire::ButtonFire) : 0;
+	}
+}
+
+#if !UE_BUILD_SHIPPING
+
+// ---- Benchmark ----
+// SWI.Hub.BenchImuDecode [PathToNdjson] [Iterations]
+// Replays the IMU payloads of a hub gyro_log.ndjson through both decoders and logs ns/message.
+
+static void RunImuDecodeBenchmark(const TArray<FString>& Args)
+{
+	const FString Path = Args.Num() > 0 ? Args[0] : FPaths::Combine(FPaths::ProjectDir(), TEXT("Sockets/gyro_log.ndjson"));
+	const int32 Iterations = Args.Num() > 1 ? FMath::Max(1, FCString::Atoi(*Args[1])) : 20;
+
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *Path))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[HUB] BenchImuDecode: cannot read %s"), *Path);
+		return;
+	}
+
+	// The hub log wraps each packet as {"server_ts":..,"payload":{..}}; rebuild the wire message UE receives.
+	TArray<FString> Messages;
+	for (const FString& Line : Lines)
+	{
+		TSharedPtr<FJsonObject> Root;
+		if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Line), Root) || !Root.IsValid()) continue;
+
+		const TSharedPtr<FJsonObject>* Payload = nullptr;
+		TSharedPtr<FJsonObject> Msg = Root->TryGetObjectField(TEXT("payload"), Payload) && Payload ? *Payload : Root;
+
+		FString Type;
+		if (!Msg->TryGetStringField(TEXT("type"), Type) || !Type.Equals(TEXT("imu"), ESearchCase::IgnoreCase)) continue;
+
+		FString Out;
+		const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+			TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Out);
+		FJsonSerializer::Serialize(Msg.ToSharedRef(), Writer);
+		Messages.Add(MoveTemp(Out));
+	}
+
+	if (Messages.Num() == 0)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[HUB] BenchImuDecode: no imu lines in %s"), *Path);
+		return;
+	}
+
+	int32 Mismatches = 0;
+	for (const FString& Msg : Messages)
+	{
+		FSWIHubImuFrame A, B;
+		FSWIHubDeviceIdentity IdA, IdB;
+		TSharedPtr<FJsonObject> Root;
+		FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Msg), Root);
+		SWIHubImuDecoder::DecodeFromJsonObject(Root, A, IdA);
+		SWIHubImuDecoder::Decode(Msg, B, IdB);
+		const bool bSame = IdA.Uid == IdB.Uid && IdA.Name == IdB.Name && IdA.MatchId == IdB.MatchId && A.TsMs == B.TsMs
+			&& A.HubRxMs == B.HubRxMs && A.HubTxMs == B.HubTxMs
+			&& A.Yaw == B.Yaw && A.Pitch == B.Pitch && A.Roll == B.Roll
+			&& A.Ax == B.Ax && A.Ay == B.Ay && A.Az == B.Az
+			&& A.Gx == B.Gx && A.Gy == B.Gy && A.Gz == B.Gz && A.Fire == B.Fire
+			&& A.Seq == B.Seq && A.Buttons == B.Buttons;
+		Mismatches += bSame ? 0 : 1;
+	}
+
+	double Sink = 0.0;
+
+	const uint64 DomStart = FPlatformTime::Cycles64();
+	for (int32 It = 0; It < Iterations; ++It)
+	{
+		for (const FString& Msg : Messages)
+		{
+			TSharedPtr<FJsonObject> Root;
+			if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Msg), Root)) continue;
+			FSWIHubImuFrame Frame;
+			FSWIHubDeviceIdentity Identity;
+			SWIHubImuDecoder::DecodeFromJsonObject(Root, Frame, Identity);
+			Sink += Frame.Yaw;
+		}
+	}
+	const double DomMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - DomStart);
+
+	FSWIHubImuFrame Reused;
+	FSWIHubDeviceIdentity ReusedIdentity;
+	const uint64 StreamStart = FPlatformTime::Cycles64();
+	for (int32 It = 0; It < Iterations; ++It)
+	{
+		for (const FString& Msg : Messages)
+		{
+			SWIHubImuDecoder::Decode(Msg, Reused, ReusedIdentity);
+			Sink += Reused.Yaw;
+		}
+	}
+	const double StreamMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StreamStart);
+
+	// What the socket callback does per message: decode, then turn the identity into the frame's handle.
+	FSWIHubDeviceHandles Handles;
+	const uint64 InternStart = FPlatformTime::Cycles64();
+	for (int32 It = 0; It < Iterations; ++It)
+	{
+		for (const FString& Msg : Messages)
+		{
+			SWIHubImuDecoder::Decode(Msg, Reused, ReusedIdentity);
+			Reused.Device = Handles.Intern(ReusedIdentity);
+			Sink += Reused.Device;
+		}
+	}
+	const double InternMs = FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - InternStart);
+
+	const double Count = static_cast<double>(Messages.Num()) * Iterations;
+	UE_LOG(LogTemp, Log, TEXT("[HUB] BenchImuDecode msgs=%d iters=%d mismatches=%d | dom=%.1f ns/msg stream=%.1f ns/msg (x%.2f) stream+intern=%.1f ns/msg devices=%d sink=%.1f"),
+		Messages.Num(), Iterations, Mismatches,
+		DomMs * 1.0e6 / Count, StreamMs * 1.0e6 / Count,
+		StreamMs > 0.0 ? DomMs / StreamMs : 0.0, InternMs * 1.0e6 / Count, Handles.Num(), Sink);
+}
+
+static FAutoConsoleCommand GSWIHubBenchImuDecodeCmd(
+	TEXT("SWI.Hub.BenchImuDecode"),
+	TEXT("Compare the streaming IMU decoder against the JSON DOM path. Args: [PathToNdjson] [Iterations]"),
+	FConsoleCommandWithArgsDelegate::CreateStatic(&RunImuDecodeBenchmark)
+);
+
+#endif // !UE_BUILD_SHIPPING
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SWI/SWIHubProtocolTypes.h"
+#include "SWI/Hub/SWIHubDeviceHandles.h"
+
+class FJsonObject;
+
+enum class ESWIHubDecodeResult : uint8
+{
+	Imu,		// "type":"imu" and every known key decoded
+	OtherType,	// well-formed so far but not an IMU message; use the DOM path
+	Malformed,	// not something the streaming decoder understands; use the DOM path
+};
+
+// Compact binary "imu" frame, negotiated with hello {"imu_format":"bin1"}.
+// Little-endian, packed: u8 Magic, u8 Version, u16 DeviceIndex, f64 TsMs,
+// f32 Yaw Pitch Roll Ax Ay Az Gx Gy Gz, u32 Buttons.
+// Version 2 appends f64 HubRxMs, f64 HubTxMs (hub wall clock, for latency tracing).
+// Version 3 appends u32 Seq after those (phones send the hub stamps as 0).
+namespace SWIHubImuWire
+{
+	inline constexpr const TCHAR* FormatName = TEXT("bin1");
+	inline constexpr uint8 Magic = 0xB1;
+	inline constexpr uint8 Version = 1;
+	inline constexpr int32 FrameSize = 52;
+	inline constexpr uint8 VersionHubStamps = 2;
+	inline constexpr int32 FrameSizeHubStamps = FrameSize + 16;
+	inline constexpr uint8 VersionSeq = 3;
+	inline constexpr int32 FrameSizeSeq = FrameSizeHubStamps + 4;
+
+	inline constexpr uint32 ButtonFire = 1u << 0;
+}
+
+namespace SWIHubImuDecoder
+{
+	/**
+	 * Single pass over one JSON object, writing the known IMU keys straight into Out and uid / name / match id into
+	 * OutIdentity for the caller to intern (Out.Device is left INDEX_NONE).
+	 * No DOM and no heap allocation; the identity strings reuse the capacity already held by OutIdentity.
+	 * Bails out as soon as a non-IMU "type" is seen.
+	 */
+	SWI_API ESWIHubDecodeResult Decode(FStringView Json, FSWIHubImuFrame& Out, FSWIHubDeviceIdentity& OutIdentity);
+
+	/**
+	 * Decodes one binary frame. Out.Device is left untouched: the caller resolves
+	 * OutDeviceIndex through the hub's "device_index" announcements.
+	 */
+	SWI_API bool DecodeBinary(TConstArrayView<uint8> Bytes, uint16& OutDeviceIndex, FSWIHubImuFrame& Out);
+
+	// Reference (DOM) decoder, used for the fallback path and as the benchmark baseline.
+	SWI_API bool DecodeFromJsonObject(const TSharedPtr<FJsonObject>& Root, FSWIHubImuFrame& Out, FSWIHubDeviceIdentity& OutIdentity);
+
+	// Keeps Buttons and Fire consistent after a JSON decode; bHasButtons = the message carried "buttons".
+	SWI_API void ResolveButtons(FSWIHubImuFrame& Frame, bool bHasButtons);
+}
@@ -0,0 +1,241 @@
+#include "SWIHubLatencyStats.h"
+#include "ProfilingDebugging/CountersTrace.h"
+#include "Stats/Stats.h"
+
+DECLARE_STATS_GROUP(TEXT("SWI Input Latency"), STATGROUP_SWIInputLatency, STATCAT_Advanced);
+
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Phone->Hub p95 (ms)"), STAT_SWILatency_PhoneToHub, STATGROUP_SWIInputLatency);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Hub dwell p95 (ms)"), STAT_SWILatency_HubDwell, STATGROUP_SWIInputLatency);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Hub->Socket p95 (ms)"), STAT_SWILatency_HubToClient, STATGROUP_SWIInputLatency);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Socket->GameThread p95 (ms)"), STAT_SWILatency_SocketToGame, STATGROUP_SWIInputLatency);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("GameThread->Apply p95 (ms)"), STAT_SWILatency_GameToApply, STATGROUP_SWIInputLatency);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Total p50 (ms)"), STAT_SWILatency_TotalP50, STATGROUP_SWIInputLatency);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Total p95 (ms)"), STAT_SWILatency_TotalP95, STATGROUP_SWIInputLatency);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Total p99 (ms)"), STAT_SWILatency_TotalP99, STATGROUP_SWIInputLatency);
+
+TRACE_DECLARE_FLOAT_COUNTER(SWILatencyPhoneToHub, TEXT("SWI/Latency/PhoneToHubMs"));
+TRACE_DECLARE_FLOAT_COUNTER(SWILatencyHubDwell, TEXT("SWI/Latency/HubDwellMs"));
+TRACE_DECLARE_FLOAT_COUNTER(SWILatencyHubToClient, TEXT("SWI/Latency/HubToSocketMs"));
+TRACE_DECLARE_FLOAT_COUNTER(SWILatencySocketToGame, TEXT("SWI/Latency/SocketToGameThreadMs"));
+TRACE_DECLARE_FLOAT_COUNTER(SWILatencyGameToApply, TEXT("SWI/Latency/GameThreadToApplyMs"));
+TRACE_DECLARE_FLOAT_COUNTER(SWILatencyTotal, TEXT("SWI/Latency/TotalMs"));
+
+const TCHAR* LexToString(ESWIHubLatencyStage Stage)
+{
+	switch (Stage)
+	{
+	case ESWIHubLatencyStage::PhoneToHub:	return TEXT("Phone->Hub");
+	case ESWIHubLatencyStage::HubDwell:		return TEXT("HubDwell");
+	case ESWIHubLatencyStage::HubToClient:	return TEXT("Hub->Socket");
+	case ESWIHubLatencyStage::SocketToGame:	return TEXT("Socket->Game");
+	case ESWIHubLatencyStage::GameToApply:	return TEXT("Game->Apply");
+	case ESWIHubLatencyStage::Total:		return TEXT("Total");
+	default:								return TEXT("?");
+	}
+}
+
+// ---- Histogram ----
+
+int32 FSWILatencyHistogram::BucketIndex(uint64 Us)
+{
+	Us = FMath::Min<uint64>(Us, (1ull << MaxMagnitude) - 1);
+	if (Us < (1ull << SubBucketBits))
+	{
+		return static_cast<int32>(Us);
+	}
+	const int32 Shift = static_cast<int32>(FMath::FloorLog2_64(Us)) - SubBucketBits + 1;
+	return Shift * SubBucketHalf + static_cast<int32>(Us >> Shift);
+}
+
+uint64 FSWILatencyHistogram::BucketMidpoint(int32 Index)
+{
+	if (Index < 2 * SubBucketHalf)
+	{
+		return static_cast<uint64>(Index);
+	}
+	const int32 Shift = Index / SubBucketHalf - 1;
+	const uint64 Sub = static_cast<uint64>(Index - Shift * SubBucketHalf);
+	return (Sub << Shift) + ((1ull << Shift) >> 1);
+}
+
+void FSWILatencyHistogram::Record(double Ms)
+{
+	if (Ms < 0.0)
+	{
+		++NumNegative;
+		Ms = 0.0;
+	}
+	const uint64 Us = static_cast<uint64>(Ms * 1000.0 + 0.5);
+
+	++Buckets[BucketIndex(Us)];
+	++Count;
+	MaxUs = FMath::Max(MaxUs, Us);
+	SumUs += static_cast<double>(Us);
+}
+
+void FSWILatencyHistogram::Merge(const FSWILatencyHistogram& Other)
+{
+	for (int32 i = 0; i < NumBuckets; ++i)
+	{
+		Buckets[i] += Other.Buckets[i];
+	}
+	Count += Other.Count;
+	NumNegative += Other.NumNegative;
+	MaxUs = FMath::Max(MaxUs, Other.MaxUs);
+	SumUs += Other.SumUs;
+}
+
+void FSWILatencyHistogram::Reset()
+{
+	*this = FSWILatencyHistogram();
+}
+
+double FSWILatencyHistogram::GetPercentileMs(double P) const
+{
+	if (Count == 0) return 0.0;
+
+	const uint64 Rank = FMath::Clamp<uint64>(static_cast<uint64>(FMath::CeilToDouble(P * Count)), 1, Count);
+	uint64 Seen = 0;
+	for (int32 i = 0; i < NumBuckets; ++i)
+	{
+		Seen += Buckets[i];
+		if (Seen >= Rank)
+		{
+			return FMath::Min(BucketMidpoint(i), MaxUs) * 0.001;
+		}
+	}
+	return MaxUs * 0.001;
+}
+
+// ---- Tracker ----
+
+double FSWIHubLatencyTracker::ToUnixMs(double PlatformSec)
+{
+	// FPlatformTime is monotonic; anchor it to the wall clock once.
+	static const double OffsetMs = (FDateTime::UtcNow() - FDateTime(1970, 1, 1)).GetTotalMilliseconds() - FPlatformTime::Seconds() * 1000.0;
+	return PlatformSec * 1000.0 + OffsetMs;
+}
+
+void FSWIHubLatencyTracker::Record(FDeviceHistograms& Device, ESWIHubLatencyStage Stage, double Ms)
+{
+	const int32 Index = static_cast<int32>(Stage);
+	Device.Stages[Index].Record(Ms);
+	Window[Index].Record(Ms);
+
+	switch (Stage)
+	{
+	case ESWIHubLatencyStage::PhoneToHub:	TRACE_COUNTER_SET(SWILatencyPhoneToHub, Ms); break;
+	case ESWIHubLatencyStage::HubDwell:		TRACE_COUNTER_SET(SWILatencyHubDwell, Ms); break;
+	case ESWIHubLatencyStage::HubToClient:	TRACE_COUNTER_SET(SWILatencyHubToClient, Ms); break;
+	case ESWIHubLatencyStage::SocketToGame:	TRACE_COUNTER_SET(SWILatencySocketToGame, Ms); break;
+	case ESWIHubLatencyStage::GameToApply:	TRACE_COUNTER_SET(SWILatencyGameToApply, Ms); break;
+	case ESWIHubLatencyStage::Total:		TRACE_COUNTER_SET(SWILatencyTotal, Ms); break;
+	default: break;
+	}
+}
+
+void FSWIHubLatencyTracker::RecordArrival(const FSWIHubImuFrame& Frame)
+{
+	FDeviceHistograms& Device = Devices.FindOrAdd(Frame.Device);
+
+	// Older hubs do not stamp hub_rx / hub_tx; those stages are simply not recorded.
+	if (Frame.HubRxMs > 0.0 && Frame.TsMs > 0.0)
+	{
+		Record(Device, ESWIHubLatencyStage::PhoneToHub, Frame.HubRxMs - Frame.TsMs);
+	}
+	if (Frame.HubRxMs > 0.0 && Frame.HubTxMs > 0.0)
+	{
+		Record(Device, ESWIHubLatencyStage::HubDwell, Frame.HubTxMs - Frame.HubRxMs);
+	}
+	if (Frame.HubTxMs > 0.0)
+	{
+		Record(Device, ESWIHubLatencyStage::HubToClient, ToUnixMs(Frame.RecvTimeSec) - Frame.HubTxMs);
+	}
+	Record(Device, ESWIHubLatencyStage::SocketToGame, (Frame.DequeueTimeSec - Frame.RecvTimeSec) * 1000.0);
+}
+
+void FSWIHubLatencyTracker::RecordApply(int32 DeviceHandle, double TsMs, double DequeueTimeSec, double NowSec)
+{
+	FDeviceHistograms& Device = Devices.FindOrAdd(DeviceHandle);
+
+	if (DequeueTimeSec > 0.0)
+	{
+		Record(Device, ESWIHubLatencyStage::GameToApply, (NowSec - DequeueTimeSec) * 1000.0);
+	}
+	if (TsMs > 0.0)
+	{
+		Record(Device, ESWIHubLatencyStage::Total, ToUnixMs(NowSec) - TsMs);
+	}
+}
+
+void FSWIHubLatencyTracker::Tick(double NowSec)
+{
+	if (NowSec - WindowStartSec < WindowSec) return;
+	WindowStartSec = NowSec;
+
+	auto P95 = [this](ESWIHubLatencyStage Stage) { return static_cast<float>(Window[static_cast<int32>(Stage)].GetPercentileMs(0.95)); };
+	const FSWILatencyHistogram& Total = Window[static_cast<int32>(ESWIHubLatencyStage::Total)];
+
+	SET_FLOAT_STAT(STAT_SWILatency_PhoneToHub, P95(ESWIHubLatencyStage::PhoneToHub));
+	SET_FLOAT_STAT(STAT_SWILatency_HubDwell, P95(ESWIHubLatencyStage::HubDwell));
+	SET_FLOAT_STAT(STAT_SWILatency_HubToClient, P95(ESWIHubLatencyStage::HubToClient));
+	SET_FLOAT_STAT(STAT_SWILatency_SocketToGame, P95(ESWIHubLatencyStage::SocketToGame));
+	SET_FLOAT_STAT(STAT_SWILatency_GameToApply, P95(ESWIHubLatencyStage::GameToApply));
+	SET_FLOAT_STAT(STAT_SWILatency_TotalP50, static_cast<float>(Total.GetPercentileMs(0.50)));
+	SET_FLOAT_STAT(STAT_SWILatency_TotalP95, static_cast<float>(Total.GetPercentileMs(0.95)));
+	SET_FLOAT_STAT(STAT_SWILatency_TotalP99, static_cast<float>(Total.GetPercentileMs(0.99)));
+
+	for (FSWILatencyHistogram& H : Window)
+	{
+		H.Reset();
+	}
+}
+
+void FSWIHubLatencyTracker::Reset()
+{
+	Devices.Reset();
+	for (FSWILatencyHistogram& H : Window)
+	{
+		H.Reset();
+	}
+}
+
+const FSWILatencyHistogram* FSWIHubLatencyTracker::FindDevice(int32 DeviceHandle, ESWIHubLatencyStage Stage) const
+{
+	const FDeviceHistograms* Device = Devices.Find(DeviceHandle);
+	return Device ? &Device->Stages[static_cast<int32>(Stage)] : nullptr;
+}
+
+FSWILatencyHistogram FSWIHubLatencyTracker::MergeDevices(ESWIHubLatencyStage Stage) const
+{
+	FSWILatencyHistogram Out;
+	for (const TPair<int32, FDeviceHistograms>& It : Devices)
+	{
+		Out.Merge(It.Value.Stages[static_cast<int32>(Stage)]);
+	}
+	return Out;
+}
+
+void FSWIHubLatencyTracker::LogReport(TFunctionRef<FString(int32)> ResolveUid) const
+{
+	if (Devices.Num() == 0)
+	{
+		UE_LOG(LogTemp, Log, TEXT("[HUB] Latency: no IMU samples yet"));
+		return;
+	}
+
+	for (const TPair<int32, FDeviceHistograms>& It : Devices)
+	{
+		UE_LOG(LogTemp, Log, TEXT("[HUB] Latency uid=%s"), *ResolveUid(It.Key));
+		for (int32 i = 0; i < static_cast<int32>(ESWIHubLatencyStage::Num); ++i)
+		{
+			const FSWILatencyHistogram& H = It.Value.Stages[i];
+			if (H.GetCount() == 0) continue;
+
+			UE_LOG(LogTemp, Log, TEXT("[HUB]   %-13s n=%-7llu p50=%7.2f p95=%7.2f p99=%7.2f max=%7.2f ms%s"),
+				LexToString(static_cast<ESWIHubLatencyStage>(i)), H.GetCount(),
+				H.GetPercentileMs(0.50), H.GetPercentileMs(0.95), H.GetPercentileMs(0.99), H.GetMaxMs(),
+				H.GetNumNegative() > 0 ? *FString::Printf(TEXT(" (negative=%llu, clock skew)"), H.GetNumNegative()) : TEXT(""));
+		}
+	}
+}
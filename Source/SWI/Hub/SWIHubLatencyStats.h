@@ -0,0 +1,99 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SWI/SWIHubProtocolTypes.h"
+
+// Pipeline stages of one IMU sample, phone devicemotion -> controller AddYaw/PitchInput.
+enum class ESWIHubLatencyStage : uint8
+{
+	PhoneToHub,		// phone ts -> hub receive (phone and hub clocks)
+	HubDwell,		// hub receive -> hub forward
+	HubToClient,	// hub forward -> UE socket callback (hub and UE wall clocks; exact on the same host)
+	SocketToGame,	// socket callback -> game-thread dequeue
+	GameToApply,	// dequeue -> controller apply (includes jitter-buffer delay when enabled)
+	Total,			// phone ts -> controller apply (phone and UE clocks)
+	Num
+};
+
+SWI_API const TCHAR* LexToString(ESWIHubLatencyStage Stage);
+
+/**
+ * Log-linear latency histogram in the HdrHistogram layout: 16 linear sub-buckets per power of two (~3% resolution),
+ * microsecond units, up to ~134 s. Fixed size, no allocation on Record.
+ */
+class SWI_API FSWILatencyHistogram
+{
+public:
+	void Record(double Ms);
+	void Merge(const FSWILatencyHistogram& Other);
+	void Reset();
+
+	// P in [0, 1]. 0 when empty.
+	double GetPercentileMs(double P) const;
+
+	uint64 GetCount() const { return Count; }
+	uint64 GetNumNegative() const { return NumNegative; }
+	double GetMaxMs() const { return MaxUs * 0.001; }
+	double GetMeanMs() const { return Count > 0 ? SumUs * 0.001 / Count : 0.0; }
+
+private:
+	static constexpr int32 SubBucketBits = 5;
+	static constexpr int32 SubBucketHalf = 1 << (SubBucketBits - 1);
+	static constexpr int32 MaxMagnitude = 27;
+	static constexpr int32 NumBuckets = (MaxMagnitude - SubBucketBits + 2) * SubBucketHalf;
+
+	static int32 BucketIndex(uint64 Us);
+	static uint64 BucketMidpoint(int32 Index);
+
+	uint32 Buckets[NumBuckets] = {};
+	uint64 Count = 0;
+	uint64 NumNegative = 0;		// cross-clock stages: a negative value means the sender clock runs ahead
+	uint64 MaxUs = 0;
+	double SumUs = 0.0;
+};
+
+/**
+ * Per-device stage histograms since the last reset, plus an all-device window that feeds
+ * "stat SWIInputLatency" and the Unreal Insights counters. Game thread only.
+ *
+ * Hub and phone timestamps are Unix ms; UE stages use FPlatformTime. Cross-clock stages assume the clocks are
+ * NTP-synced, so read their absolute value with care and their spread (p99 - p50) with confidence.
+ */
+class SWI_API FSWIHubLatencyTracker
+{
+public:
+	// Stats window for the all-device percentiles.
+	double WindowSec = 2.0;
+
+	static double ToUnixMs(double PlatformSec);
+
+	// At the game-thread dequeue; Frame.DequeueTimeSec must be stamped.
+	void RecordArrival(const FSWIHubImuFrame& Frame);
+
+	// When the controller applied input built from a sample (the newest one since the last apply).
+	void RecordApply(int32 DeviceHandle, double TsMs, double DequeueTimeSec, double NowSec);
+
+	void Tick(double NowSec);
+	void Reset();
+
+	// DeviceHandle = FSWIHubImuFrame::Device.
+	const FSWILatencyHistogram* FindDevice(int32 DeviceHandle, ESWIHubLatencyStage Stage) const;
+
+	// One stage over every device since the last reset.
+	FSWILatencyHistogram MergeDevices(ESWIHubLatencyStage Stage) const;
+
+	// ResolveUid turns a device handle into the uid printed in the report.
+	void LogReport(TFunctionRef<FString(int32)> ResolveUid) const;
+
+private:
+	struct FDeviceHistograms
+	{
+		FSWILatencyHistogram Stages[static_cast<int32>(ESWIHubLatencyStage::Num)];
+	};
+
+	void Record(FDeviceHistograms& Device, ESWIHubLatencyStage Stage, double Ms);
+
+	TMap<int32, FDeviceHistograms> Devices;
+	FSWILatencyHistogram Window[static_cast<int32>(ESWIHubLatencyStage::Num)];
+	double WindowStartSec = 0.0;
+};
@@ -0,0 +1,324 @@
+#include "SWIHubLoadGenerator.h"
+#include "SWIHubImuDecoder.h"
+#include "SWIHubLatencyStats.h"
+#include "SWIHubTrafficLog.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/RunnableThread.h"
+#include "IWebSocketNetworkingModule.h"
+#include "IWebSocketServer.h"
+#include "INetworkingWebSocket.h"
+#include "WebSocketNetworkingDelegates.h"
+#include "Modules/ModuleManager.h"
+
+namespace
+{
+	template<typename T>
+	void Put(TArray<uint8>& Out, T Value)
+	{
+		// Wire format is little-endian, like every platform UE ships on.
+		const int32 At = Out.AddUninitialized(sizeof(T));
+		FMemory::Memcpy(Out.GetData() + At, &Value, sizeof(T));
+	}
+
+	// Smooth hand motion: slow yaw sweeps plus small pitch/roll wobble, with matching rates and gravity.
+	void SynthesizeFrame(int32 Device, double TimeSec, FSWIHubImuFrame& Out)
+	{
+		const double Phase = Device * 0.618;
+		const double W1 = 2.0 * UE_DOUBLE_PI * 0.35;
+		const double W2 = 2.0 * UE_DOUBLE_PI * 0.9;
+		const double W3 = 2.0 * UE_DOUBLE_PI * 0.6;
+
+		const double Yaw = 40.0 * FMath::Sin(W1 * TimeSec + Phase);
+		const double Beta = 10.0 * FMath::Sin(W2 * TimeSec + Phase);
+		const double Gamma = 8.0 * FMath::Sin(W3 * TimeSec + 2.0 * Phase);
+
+		Out.Yaw = static_cast<float>(Yaw);
+		Out.Pitch = static_cast<float>(Beta);
+		Out.Roll = static_cast<float>(Gamma);
+
+		// Hub naming: Gx/Gy/Gz = alpha/beta/gamma rates.
+		Out.Gx = static_cast<float>(40.0 * W1 * FMath::Cos(W1 * TimeSec + Phase));
+		Out.Gy = static_cast<float>(10.0 * W2 * FMath::Cos(W2 * TimeSec + Phase));
+		Out.Gz = static_cast<float>(8.0 * W3 * FMath::Cos(W3 * TimeSec + 2.0 * Phase));
+
+		const double B = FMath::DegreesToRadians(Beta);
+		const double G = FMath::DegreesToRadians(Gamma);
+		Out.Ax = static_cast<float>(-9.81 * FMath::Sin(G));
+		Out.Ay = static_cast<float>(9.81 * FMath::Sin(B));
+		Out.Az = static_cast<float>(9.81 * FMath::Cos(B) * FMath::Cos(G));
+
+		// A short press every ~3 s so the fire path is exercised too.
+		Out.Buttons = FMath::Fmod(TimeSec + Device * 0.37, 3.0) < 0.05 ? static_cast<int32>(SWIHubImuWire::ButtonFire) : 0;
+		Out.Fire = Out.Buttons & SWIHubImuWire::ButtonFire;
+	}
+}
+
+FSWIHubLoadGenerator::~FSWIHubLoadGenerator()
+{
+	Shutdown();
+}
+
+FString FSWIHubLoadGenerator::GetDeviceUid(int32 Index)
+{
+	return FString::Printf(TEXT("load-%03d"), Index);
+}
+
+FString FSWIHubLoadGenerator::GetUrl() const
+{
+	return FString::Printf(TEXT("ws://127.0.0.1:%d/ws?role=ue&uid=loadtest&name=LoadTest"), Config.Port);
+}
+
+bool FSWIHubLoadGenerator::Start(const FSWIHubLoadConfig& InConfig)
+{
+	Shutdown();
+
+	Config = InConfig;
+	Config.NumDevices = FMath::Clamp(Config.NumDevices, 1, static_cast<int32>(MAX_uint16));
+	Config.RateHz = FMath::Max(Config.RateHz, 1.f);
+
+	LoadSource();
+	NextSeq.SetNumZeroed(Config.NumDevices);
+
+	Server = FModuleManager::LoadModuleChecked<IWebSocketNetworkingModule>(TEXT("WebSocketNetworking")).CreateServer();
+
+	FWebSocketClientConnectedCallBack OnConnected;
+	OnConnected.BindRaw(this, &FSWIHubLoadGenerator::HandleClientConnected);
+	if (!Server->Init(static_cast<uint32>(Config.Port), OnConnected, TEXT("127.0.0.1")))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[HUB] LoadGen: failed to listen on 127.0.0.1:%d"), Config.Port);
+		Server.Reset();
+		return false;
+	}
+
+	bStopping = false;
+	bPaused = false;
+	bHasClient = false;
+	FramesSent = 0;
+	FramesSkipped = 0;
+
+	Thread = FRunnableThread::Create(this, TEXT("SWIHubLoadGenerator"), 0, TPri_AboveNormal);
+	return Thread != nullptr;
+}
+
+void FSWIHubLoadGenerator::Shutdown()
+{
+	if (Thread)
+	{
+		bStopping = true;
+		Thread->WaitForCompletion();
+		delete Thread;
+		Thread = nullptr;
+	}
+
+	Server.Reset();
+	Client = nullptr;
+	bAnnounced = false;
+	bHasClient = false;
+}
+
+void FSWIHubLoadGenerator::LoadSource()
+{
+	SourceFrames.Reset();
+	SourceCursor.Reset();
+
+	if (Config.SourcePath.IsEmpty()) return;
+
+	TUniquePtr<FSWIHubTrafficReader> Reader = FSWIHubTrafficReader::Open(Config.SourcePath);
+	if (!Reader.IsValid())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[HUB] LoadGen: cannot open %s, using synthetic motion"), *Config.SourcePath);
+		return;
+	}
+
+	// Motion only; every device loops the same clip from a different offset.
+	FSWIHubTrafficRecord Record;
+	while (SourceFrames.Num() < MaxSourceFrames && Reader->Next(Record))
+	{
+		if (Record.Kind == FSWIHubTrafficRecord::EKind::Imu)
+		{
+			SourceFrames.Add(MoveTemp(Record.Frame));
+		}
+	}
+
+	if (SourceFrames.Num() > 0)
+	{
+		SourceCursor.SetNum(Config.NumDevices);
+		for (int32 i = 0; i < Config.NumDevices; ++i)
+		{
+			SourceCursor[i] = static_cast<int32>(static_cast<int64>(i) * SourceFrames.Num() / Config.NumDevices);
+		}
+	}
+	UE_LOG(LogTemp, Log, TEXT("[HUB] LoadGen: %d source frames from %s"), SourceFrames.Num(), *Config.SourcePath);
+}
+
+uint32 FSWIHubLoadGenerator::Run()
+{
+	// One send slot per device per period, spread evenly so the client sees a steady mix, not bursts of N.
+	const double SlotSec = 1.0 / (static_cast<double>(Config.RateHz) * Config.NumDevices);
+	double NextSlotSec = 0.0;
+	int64 Slot = 0;
+
+	while (!bStopping)
+	{
+		Server->Tick();
+
+		const double Now = FPlatformTime::Seconds();
+		if (!Client || bPaused)
+		{
+			NextSlotSec = Now;
+			FPlatformProcess::Sleep(0.001f);
+			continue;
+		}
+
+		if (!bAnnounced)
+		{
+			Announce(true);
+			bAnnounced = true;
+			NextSlotSec = Now;
+		}
+
+		if (Now - NextSlotSec > MaxBehindSec)
+		{
+			const int64 Behind = static_cast<int64>((Now - NextSlotSec) / SlotSec);
+			FramesSkipped.fetch_add(static_cast<uint64>(Behind), std::memory_order_relaxed);
+			Slot += Behind;
+			NextSlotSec += Behind * SlotSec;
+		}
+
+		while (NextSlotSec <= Now && Client)
+		{
+			SendFrame(static_cast<int32>(Slot % Config.NumDevices), Now);
+			++Slot;
+			NextSlotSec += SlotSec;
+		}
+
+		const double WaitSec = NextSlotSec - FPlatformTime::Seconds();
+		if (WaitSec > 0.0005)
+		{
+			FPlatformProcess::Sleep(static_cast<float>(FMath::Min(WaitSec, 0.001)));
+		}
+	}
+
+	if (Client && bAnnounced)
+	{
+		Announce(false);
+		for (int32 i = 0; i < 10; ++i)
+		{
+			Server->Tick();
+			FPlatformProcess::Sleep(0.005f);
+		}
+	}
+	return 0;
+}
+
+void FSWIHubLoadGenerator::HandleClientConnected(INetworkingWebSocket* Socket)
+{
+	if (Client)
+	{
+		// One UE client per run; extra connections are left unserviced.
+		return;
+	}
+
+	Client = Socket;
+	bAnnounced = false;
+
+	// The client's hello is not needed: the format is fixed by the config.
+	FWebSocketPacketReceivedCallBack OnPacket;
+	OnPacket.BindLambda([](void*, int32) {});
+	Socket->SetReceiveCallBack(OnPacket);
+
+	FWebSocketInfoCallBack OnClosed;
+	OnClosed.BindRaw(this, &FSWIHubLoadGenerator::HandleClientClosed);
+	Socket->SetSocketClosedCallBack(OnClosed);
+
+	FWebSocketInfoCallBack OnError;
+	OnError.BindRaw(this, &FSWIHubLoadGenerator::HandleClientClosed);
+	Socket->SetErrorCallBack(OnError);
+
+	bHasClient = true;
+}
+
+void FSWIHubLoadGenerator::HandleClientClosed()
+{
+	Client = nullptr;
+	bAnnounced = false;
+	bHasClient = false;
+}
+
+void FSWIHubLoadGenerator::Announce(bool bConnected)
+{
+	for (int32 i = 0; i < Config.NumDevices; ++i)
+	{
+		const FString Uid = GetDeviceUid(i);
+		SendJson(FString::Printf(TEXT("{\"type\":\"%s\",\"uid\":\"%s\",\"name\":\"Load %d\",\"role\":\"phone\",\"remote\":\"127.0.0.1\"}"),
+			bConnected ? TEXT("device_connected") : TEXT("device_disconnected"), *Uid, i));
+
+		if (bConnected && Config.bBinary)
+		{
+			SendJson(FString::Printf(TEXT("{\"type\":\"device_index\",\"idx\":%d,\"uid\":\"%s\",\"name\":\"Load %d\",\"match_id\":\"\"}"), i, *Uid, i));
+		}
+	}
+}
+
+void FSWIHubLoadGenerator::SendFrame(int32 Device, double NowSec)
+{
+	FSWIHubImuFrame Frame;
+	if (SourceFrames.Num() > 0)
+	{
+		int32& Cursor = SourceCursor[Device];
+		Frame = SourceFrames[Cursor];
+		Cursor = (Cursor + 1) % SourceFrames.Num();
+	}
+	else
+	{
+		SynthesizeFrame(Device, NowSec, Frame);
+	}
+
+	// Phone, hub and UE share this host's clock, so every latency stage is exact.
+	const double NowMs = FSWIHubLatencyTracker::ToUnixMs(NowSec);
+	Frame.TsMs = NowMs;
+	Frame.HubRxMs = NowMs;
+	Frame.HubTxMs = NowMs;
+	Frame.Seq = ++NextSeq[Device];
+
+	if (Config.bBinary)
+	{
+		Packet.Reset();
+		Put<uint8>(Packet, SWIHubImuWire::Magic);
+		Put<uint8>(Packet, SWIHubImuWire::VersionSeq);
+		Put<uint16>(Packet, static_cast<uint16>(Device));
+		Put<double>(Packet, Frame.TsMs);
+		for (const float V : { Frame.Yaw, Frame.Pitch, Frame.Roll, Frame.Ax, Frame.Ay, Frame.Az, Frame.Gx, Frame.Gy, Frame.Gz })
+		{
+			Put<float>(Packet, V);
+		}
+		Put<uint32>(Packet, static_cast<uint32>(Frame.Buttons));
+		Put<double>(Packet, Frame.HubRxMs);
+		Put<double>(Packet, Frame.HubTxMs);
+		Put<uint32>(Packet, static_cast<uint32>(Frame.Seq));
+		check(Packet.Num() == SWIHubImuWire::FrameSizeSeq);
+
+		Client->Send(Packet.GetData(), static_cast<uint32>(Packet.Num()), /*bPrependSize=*/false);
+	}
+	else
+	{
+		SendJson(FString::Printf(
+			TEXT("{\"type\":\"imu\",\"uid\":\"%s\",\"name\":\"Load %d\",\"ts\":%.3f,")
+			TEXT("\"yaw\":%.3f,\"pitch\":%.3f,\"roll\":%.3f,\"ax\":%.3f,\"ay\":%.3f,\"az\":%.3f,")
+			TEXT("\"gx\":%.3f,\"gy\":%.3f,\"gz\":%.3f,\"fire\":%d,\"buttons\":%d,\"seq\":%lld,")
+			TEXT("\"hub_rx\":%.3f,\"hub_tx\":%.3f}"),
+			*GetDeviceUid(Device), Device, Frame.TsMs,
+			Frame.Yaw, Frame.Pitch, Frame.Roll, Frame.Ax, Frame.Ay, Frame.Az, Frame.Gx, Frame.Gy, Frame.Gz,
+			Frame.Fire, Frame.Buttons, Frame.Seq, Frame.HubRxMs, Frame.HubTxMs));
+	}
+
+	FramesSent.fetch_add(1, std::memory_order_relaxed);
+}
+
+void FSWIHubLoadGenerator::SendJson(const FString& Json)
+{
+	if (!Client) return;
+
+	const FTCHARToUTF8 Utf8(*Json);
+	Client->Send(reinterpret_cast<const uint8*>(Utf8.Get()), static_cast<uint32>(Utf8.Length()), /*bPrependSize=*/false);
+}
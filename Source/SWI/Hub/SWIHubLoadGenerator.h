@@ -0,0 +1,91 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "SWI/SWIHubProtocolTypes.h"
+#include <atomic>
+
+class FRunnableThread;
+class IWebSocketServer;
+class INetworkingWebSocket;
+
+struct FSWIHubLoadConfig
+{
+	int32 NumDevices = 16;
+	float RateHz = 100.f;
+
+	// bin1 v3 frames with device_index announcements, or JSON "imu" messages.
+	bool bBinary = true;
+
+	int32 Port = 18090;
+
+	// Optional .swirec / gyro_log.ndjson whose IMU motion is looped per device (timing still comes from RateHz).
+	FString SourcePath;
+};
+
+/**
+ * Loopback stand-in for imu_hub.py that streams synthetic or recorded IMU for many virtual phones.
+ *
+ * USWIHubClientSubsystem connects to it like to the real hub (GetUrl), so the whole receive path is measured:
+ * socket callback decode, bounded queue, per-tick drain, routing and the receivers.
+ * The server is serviced on its own thread; sends are spread evenly over each 1 / RateHz period like real phones.
+ */
+class SWI_API FSWIHubLoadGenerator : public FRunnable
+{
+public:
+	virtual ~FSWIHubLoadGenerator() override;
+
+	// Game thread. Listens on 127.0.0.1:Port and starts the sender thread.
+	bool Start(const FSWIHubLoadConfig& InConfig);
+
+	// Game thread. Sends device_disconnected for every virtual device, then joins the thread.
+	void Shutdown();
+
+	// Stops sending IMU but keeps the connection (lets the client drain before counters are read).
+	void Pause() { bPaused = true; }
+
+	FString GetUrl() const;
+	static FString GetDeviceUid(int32 Index);
+
+	bool HasClient() const { return bHasClient.load(std::memory_order_relaxed); }
+	uint64 GetFramesSent() const { return FramesSent.load(std::memory_order_relaxed); }
+
+	// Send slots given up because the thread fell more than MaxBehindSec behind schedule.
+	uint64 GetFramesSkipped() const { return FramesSkipped.load(std::memory_order_relaxed); }
+
+	// FRunnable
+	virtual uint32 Run() override;
+	virtual void Stop() override { bStopping = true; }
+	// ~FRunnable
+
+private:
+	static constexpr double MaxBehindSec = 0.25;
+	static constexpr int32 MaxSourceFrames = 60000;
+
+	void HandleClientConnected(INetworkingWebSocket* Socket);
+	void HandleClientClosed();
+
+	void Announce(bool bConnected);
+	void SendFrame(int32 Device, double NowSec);
+	void SendJson(const FString& Json);
+	void LoadSource();
+
+	FSWIHubLoadConfig Config;
+
+	TUniquePtr<IWebSocketServer> Server;
+	FRunnableThread* Thread = nullptr;
+
+	// Sender thread only
+	INetworkingWebSocket* Client = nullptr;
+	bool bAnnounced = false;
+	TArray<FSWIHubImuFrame> SourceFrames;
+	TArray<int32> SourceCursor;
+	TArray<uint32> NextSeq;
+	TArray<uint8> Packet;
+
+	std::atomic<bool> bStopping{ false };
+	std::atomic<bool> bPaused{ false };
+	std::atomic<bool> bHasClient{ false };
+	std::atomic<uint64> FramesSent{ 0 };
+	std::atomic<uint64> FramesSkipped{ 0 };
+};
@@ -0,0 +1,534 @@
+#include "SWIHubLoadGenerator.h"
+#include "SWIHubLatencyStats.h"
+#include "SWI/SubSystems/SWIHubServiceSubsystem.h"
+#include "SWI/Components/SWIGyroInputReceiverComponent.h"
+#include "Dom/JsonObject.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/App.h"
+#include "Misc/EngineVersion.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "Tickable.h"
+
+#if !UE_BUILD_SHIPPING
+
+// ---- Load test ----
+// SWI.Hub.LoadTest devices=1,16,64,256 rate=100 format=bin|json seconds=10 [warmup=2] [source=<recording>]
+//                  [port=18090] [out=<dir>] [quit=1]   |   SWI.Hub.LoadTest stop
+//
+// For every (devices, rate) pair: starts FSWIHubLoadGenerator, points the hub client at it, spawns one
+// USWIGyroInputReceiverComponent per virtual phone (ticked and consumed here like the controller does),
+// then measures a steady-state window. Results go to Saved/HubBench/HubLoadTest_<time>.csv and .json.
+// Headless: UnrealEditor SWI.uproject -game -nullrhi -unattended -ExecCmds="SWI.Hub.LoadTest ... quit=1"
+
+namespace
+{
+	struct FLoadTestOptions
+	{
+		TArray<int32> DeviceCounts;
+		TArray<float> RatesHz;
+		bool bBinary = true;
+		double WarmupSec = 2.0;
+		double MeasureSec = 10.0;
+		double SettleSec = 1.0;
+		double ConnectTimeoutSec = 10.0;
+		int32 Port = 18090;
+		FString SourcePath;
+		FString OutDir;
+		bool bQuit = false;
+	};
+
+	struct FLoadTestRow
+	{
+		int32 Devices = 0;
+		float RateHz = 0.f;
+		bool bConnected = false;
+		TArray<TPair<FString, double>> Metrics;
+
+		void Add(const TCHAR* Name, double Value) { Metrics.Emplace(Name, Value); }
+	};
+
+	double UsedPhysicalMb()
+	{
+		return FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0);
+	}
+}
+
+class FSWIHubLoadTestRunner : public FTickableGameObject
+{
+public:
+	FSWIHubLoadTestRunner(UWorld* InWorld, USWIHubClientSubsystem* InHub, FLoadTestOptions&& InOptions)
+		: World(InWorld)
+		, Hub(InHub)
+		, Options(MoveTemp(InOptions))
+	{
+		bHubWasStarted = Hub->IsHubStarted();
+		SavedUrlOverride = Hub->GetHubWsUrlOverride();
+
+		for (const int32 Devices : Options.DeviceCounts)
+		{
+			for (const float Rate : Options.RatesHz)
+			{
+				Steps.Add({ Devices, Rate });
+			}
+		}
+		BeginStep();
+	}
+
+	virtual ~FSWIHubLoadTestRunner() override
+	{
+		// At engine exit the world and hub are already gone; the generator joins its thread on its own.
+		if (Phase != EPhase::Done && !IsEngineExitRequested())
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[HUB] LoadTest: aborted"));
+			Finish();
+		}
+	}
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual bool IsTickable() const override { return Phase != EPhase::Done; }
+	virtual bool IsTickableWhenPaused() const override { return true; }
+	virtual TStatId GetStatId() const override
+	{
+		RETURN_QUICK_DECLARE_CYCLE_STAT(FSWIHubLoadTestRunner, STATGROUP_Tickables);
+	}
+	// ~FTickableGameObject
+
+private:
+	enum class EPhase : uint8 { Connect, Warmup, Measure, Settle, Done };
+
+	void BeginStep();
+	void EndStep();
+	void TickReceivers(float DeltaTime);
+	void Finish();
+	void WriteResults() const;
+
+	TWeakObjectPtr<UWorld> World;
+	TWeakObjectPtr<USWIHubClientSubsystem> Hub;
+	FLoadTestOptions Options;
+
+	bool bHubWasStarted = false;
+	FString SavedUrlOverride;
+
+	TArray<TPair<int32, float>> Steps;
+	int32 StepIndex = 0;
+	TArray<FLoadTestRow> Rows;
+
+	EPhase Phase = EPhase::Connect;
+	double PhaseStartSec = 0.0;
+	double LastTickSec = 0.0;
+
+	FSWIHubLoadGenerator Generator;
+	TWeakObjectPtr<AActor> Host;
+	TArray<TWeakObjectPtr<USWIGyroInputReceiverComponent>> Receivers;
+
+	// Measurement window
+	FSWILatencyHistogram FrameMs;
+	FSWILatencyHistogram HubMs;
+	FSWILatencyHistogram ReceiversMs;
+	uint64 Sent0 = 0, Sent1 = 0, Skipped0 = 0, Skipped1 = 0;
+	int64 Received0 = 0, Dropped0 = 0;
+	double MemStartMb = 0.0, MemPeakMb = 0.0, LastMemSampleSec = 0.0;
+};
+
+static TUniquePtr<FSWIHubLoadTestRunner> GSWIHubLoadTest;
+
+void FSWIHubLoadTestRunner::BeginStep()
+{
+	UWorld* W = World.Get();
+	USWIHubClientSubsystem* H = Hub.Get();
+	if (!W || !H)
+	{
+		Finish();
+		return;
+	}
+
+	const int32 NumDevices = Steps[StepIndex].Key;
+	const float RateHz = Steps[StepIndex].Value;
+
+	FSWIHubLoadConfig Config;
+	Config.NumDevices = NumDevices;
+	Config.RateHz = RateHz;
+	Config.bBinary = Options.bBinary;
+	Config.Port = Options.Port;
+	Config.SourcePath = Options.SourcePath;
+
+	if (!Generator.Start(Config))
+	{
+		Finish();
+		return;
+	}
+
+	FActorSpawnParameters Params;
+	Params.ObjectFlags |= RF_Transient;
+	AActor* HostActor = W->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, Params);
+	Host = HostActor;
+
+	Receivers.Reset(NumDevices);
+	for (int32 i = 0; HostActor && i < NumDevices; ++i)
+	{
+		USWIGyroInputReceiverComponent* Receiver = NewObject<USWIGyroInputReceiverComponent>(HostActor, NAME_None, RF_Transient);
+		Receiver->DeviceUid = FSWIHubLoadGenerator::GetDeviceUid(i);
+		// Ticked from here so its cost can be timed on its own (the receiver would otherwise enable its own tick).
+		Receiver->PrimaryComponentTick.bCanEverTick = false;
+		Receiver->RegisterComponent();
+		Receivers.Add(Receiver);
+	}
+
+	H->StopHub();
+	H->SetHubWsUrlOverride(Generator.GetUrl());
+	H->StartHub();
+
+	Phase = EPhase::Connect;
+	PhaseStartSec = FPlatformTime::Seconds();
+
+	UE_LOG(LogTemp, Log, TEXT("[HUB] LoadTest: step %d/%d devices=%d rate=%.0fHz format=%s"),
+		StepIndex + 1, Steps.Num(), NumDevices, RateHz, Options.bBinary ? TEXT("bin1") : TEXT("json"));
+}
+
+void FSWIHubLoadTestRunner::Tick(float DeltaTime)
+{
+	USWIHubClientSubsystem* H = Hub.Get();
+	if (!H || !World.IsValid())
+	{
+		Finish();
+		return;
+	}
+
+	const double Now = FPlatformTime::Seconds();
+	const double FrameSec = LastTickSec > 0.0 ? Now - LastTickSec : DeltaTime;
+	LastTickSec = Now;
+
+	TickReceivers(DeltaTime);
+
+	const double InPhaseSec = Now - PhaseStartSec;
+	switch (Phase)
+	{
+	case EPhase::Connect:
+		if (Generator.HasClient())
+		{
+			Phase = EPhase::Warmup;
+			PhaseStartSec = Now;
+		}
+		else if (InPhaseSec > Options.ConnectTimeoutSec)
+		{
+			UE_LOG(LogTemp, Error, TEXT("[HUB] LoadTest: hub client did not connect to %s"), *Generator.GetUrl());
+			FLoadTestRow& Row = Rows.AddDefaulted_GetRef();
+			Row.Devices = Steps[StepIndex].Key;
+			Row.RateHz = Steps[StepIndex].Value;
+			Finish();
+		}
+		break;
+
+	case EPhase::Warmup:
+		if (InPhaseSec >= Options.WarmupSec)
+		{
+			// Steady state from here: connection up, receivers bound, AHRS settled.
+			H->GetLatency().Reset();
+			FrameMs.Reset();
+			HubMs.Reset();
+			ReceiversMs.Reset();
+
+			Sent0 = Generator.GetFramesSent();
+			Skipped0 = Generator.GetFramesSkipped();
+			Received0 = H->GetImuFramesReceived();
+			Dropped0 = H->GetImuFramesDropped();
+			MemStartMb = MemPeakMb = UsedPhysicalMb();
+			LastMemSampleSec = Now;
+
+			Phase = EPhase::Measure;
+			PhaseStartSec = Now;
+		}
+		break;
+
+	case EPhase::Measure:
+		FrameMs.Record(FrameSec * 1000.0);
+		HubMs.Record(H->GetLastTickMs());
+
+		if (Now - LastMemSampleSec >= 1.0)
+		{
+			MemPeakMb = FMath::Max(MemPeakMb, UsedPhysicalMb());
+			LastMemSampleSec = Now;
+		}
+
+		if (InPhaseSec >= Options.MeasureSec)
+		{
+			Sent1 = Generator.GetFramesSent();
+			Skipped1 = Generator.GetFramesSkipped();
+			Generator.Pause();
+
+			Phase = EPhase::Settle;
+			PhaseStartSec = Now;
+		}
+		break;
+
+	case EPhase::Settle:
+		// Let in-flight frames land so the loss count only reflects real drops.
+		if (InPhaseSec >= Options.SettleSec)
+		{
+			EndStep();
+		}
+		break;
+
+	default:
+		break;
+	}
+}
+
+void FSWIHubLoadTestRunner::TickReceivers(float DeltaTime)
+{
+	if (Receivers.Num() == 0) return;
+
+	const double StartSec = FPlatformTime::Seconds();
+	for (const TWeakObjectPtr<USWIGyroInputReceiverComponent>& Ptr : Receivers)
+	{
+		USWIGyroInputReceiverComponent* Receiver = Ptr.Get();
+		if (!Receiver) continue;
+
+		Receiver->TickComponent(DeltaTime, LEVELTICK_All, &Receiver->PrimaryComponentTick);
+
+		// Same per-tick path as ASWIPlayerController.
+		FVector2D Move, Look;
+		if (Receiver->ConsumeIAValues(DeltaTime, Move, Look))
+		{
+			Receiver->NotifyInputApplied();
+		}
+	}
+
+	if (Phase == EPhase::Measure)
+	{
+		ReceiversMs.Record((FPlatformTime::Seconds() - StartSec) * 1000.0);
+	}
+}
+
+void FSWIHubLoadTestRunner::EndStep()
+{
+	USWIHubClientSubsystem* H = Hub.Get();
+	const FSWIHubLatencyTracker& Latency = H->GetLatency();
+	const FSWILatencyHistogram SocketToGame = Latency.MergeDevices(ESWIHubLatencyStage::SocketToGame);
+	const FSWILatencyHistogram Total = Latency.MergeDevices(ESWIHubLatencyStage::Total);
+
+	const uint64 Sent = Sent1 - Sent0;
+	const int64 Received = H->GetImuFramesReceived() - Received0;
+	const int64 Dropped = H->GetImuFramesDropped() - Dropped0;
+	const double MemEndMb = UsedPhysicalMb();
+
+	FLoadTestRow& Row = Rows.AddDefaulted_GetRef();
+	Row.Devices = Steps[StepIndex].Key;
+	Row.RateHz = Steps[StepIndex].Value;
+	Row.bConnected = true;
+	Row.Add(TEXT("seconds"), Options.MeasureSec);
+	Row.Add(TEXT("frames_sent"), static_cast<double>(Sent));
+	Row.Add(TEXT("frames_skipped_by_generator"), static_cast<double>(Skipped1 - Skipped0));
+	Row.Add(TEXT("frames_received"), static_cast<double>(Received));
+	Row.Add(TEXT("frames_dropped"), static_cast<double>(Dropped));
+	Row.Add(TEXT("frames_lost"), static_cast<double>(FMath::Max<int64>(static_cast<int64>(Sent) - Received, 0)));
+	Row.Add(TEXT("recv_rate_hz"), Received / Options.MeasureSec);
+	Row.Add(TEXT("frame_ms_p50"), FrameMs.GetPercentileMs(0.5));
+	Row.Add(TEXT("frame_ms_p99"), FrameMs.GetPercentileMs(0.99));
+	Row.Add(TEXT("frame_ms_max"), FrameMs.GetMaxMs());
+	Row.Add(TEXT("hub_tick_ms_mean"), HubMs.GetMeanMs());
+	Row.Add(TEXT("hub_tick_ms_p99"), HubMs.GetPercentileMs(0.99));
+	Row.Add(TEXT("receivers_ms_mean"), ReceiversMs.GetMeanMs());
+	Row.Add(TEXT("receivers_ms_p99"), ReceiversMs.GetPercentileMs(0.99));
+	Row.Add(TEXT("socket_to_game_ms_p50"), SocketToGame.GetPercentileMs(0.5));
+	Row.Add(TEXT("socket_to_game_ms_p99"), SocketToGame.GetPercentileMs(0.99));
+	Row.Add(TEXT("total_ms_p50"), Total.GetPercentileMs(0.5));
+	Row.Add(TEXT("total_ms_p99"), Total.GetPercentileMs(0.99));
+	Row.Add(TEXT("mem_used_mb"), MemEndMb);
+	Row.Add(TEXT("mem_growth_mb"), FMath::Max(MemPeakMb, MemEndMb) - MemStartMb);
+
+	UE_LOG(LogTemp, Log, TEXT("[HUB] LoadTest: devices=%d rate=%.0fHz recv=%.0f/s dropped=%lld lost=%lld frame p99=%.2fms hub=%.3fms receivers=%.3fms s2g p99=%.2fms"),
+		Row.Devices, Row.RateHz, Received / Options.MeasureSec, Dropped, FMath::Max<int64>(static_cast<int64>(Sent) - Received, 0),
+		FrameMs.GetPercentileMs(0.99), HubMs.GetMeanMs(), ReceiversMs.GetMeanMs(), SocketToGame.GetPercentileMs(0.99));
+
+	H->StopHub();
+	Generator.Shutdown();
+	if (AActor* HostActor = Host.Get())
+	{
+		HostActor->Destroy();
+	}
+	Host.Reset();
+	Receivers.Reset();
+
+	if (++StepIndex < Steps.Num())
+	{
+		BeginStep();
+	}
+	else
+	{
+		Finish();
+	}
+}
+
+void FSWIHubLoadTestRunner::Finish()
+{
+	if (Phase == EPhase::Done) return;
+	Phase = EPhase::Done;
+
+	Generator.Shutdown();
+	if (AActor* HostActor = Host.Get())
+	{
+		HostActor->Destroy();
+	}
+	Receivers.Reset();
+
+	if (USWIHubClientSubsystem* H = Hub.Get())
+	{
+		H->StopHub();
+		H->SetHubWsUrlOverride(SavedUrlOverride);
+		if (bHubWasStarted)
+		{
+			H->StartHub();
+		}
+	}
+
+	WriteResults();
+
+	const bool bFailed = Rows.Num() < Steps.Num() || Rows.ContainsByPredicate([](const FLoadTestRow& Row) { return !Row.bConnected; });
+	if (Options.bQuit)
+	{
+		FPlatformMisc::RequestExitWithStatus(false, bFailed ? 1 : 0);
+	}
+}
+
+void FSWIHubLoadTestRunner::WriteResults() const
+{
+	if (Rows.Num() == 0) return;
+
+	const FString Dir = !Options.OutDir.IsEmpty() ? Options.OutDir : FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("HubBench"));
+	const FString Base = FPaths::Combine(Dir, FDateTime::Now().ToString(TEXT("HubLoadTest_%Y%m%d_%H%M%S")));
+	const TCHAR* Format = Options.bBinary ? TEXT("bin1") : TEXT("json");
+	const FString Source = Options.SourcePath.IsEmpty() ? TEXT("synthetic") : FPaths::GetCleanFilename(Options.SourcePath);
+
+	// Column set comes from the first completed row so CSV and JSON can never disagree.
+	const FLoadTestRow* Columns = Rows.FindByPredicate([](const FLoadTestRow& Row) { return Row.bConnected; });
+
+	FString Csv = TEXT("devices,rate_hz,format,connected");
+	if (Columns)
+	{
+		for (const TPair<FString, double>& It : Columns->Metrics)
+		{
+			Csv += TEXT(",") + It.Key;
+		}
+	}
+	Csv += LINE_TERMINATOR;
+
+	TArray<TSharedPtr<FJsonValue>> JsonSteps;
+	for (const FLoadTestRow& Row : Rows)
+	{
+		Csv += FString::Printf(TEXT("%d,%.0f,%s,%d"), Row.Devices, Row.RateHz, Format, Row.bConnected ? 1 : 0);
+
+		const TSharedRef<FJsonObject> Step = MakeShared<FJsonObject>();
+		Step->SetNumberField(TEXT("devices"), Row.Devices);
+		Step->SetNumberField(TEXT("rate_hz"), Row.RateHz);
+		Step->SetBoolField(TEXT("connected"), Row.bConnected);
+
+		for (int32 i = 0; Columns && i < Columns->Metrics.Num(); ++i)
+		{
+			const double Value = Row.Metrics.IsValidIndex(i) ? Row.Metrics[i].Value : 0.0;
+			Csv += FString::Printf(TEXT(",%.4f"), Value);
+			if (Row.bConnected)
+			{
+				Step->SetNumberField(Columns->Metrics[i].Key, Value);
+			}
+		}
+		Csv += LINE_TERMINATOR;
+		JsonSteps.Add(MakeShared<FJsonValueObject>(Step));
+	}
+
+	const TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+	Root->SetStringField(TEXT("timestamp"), FDateTime::UtcNow().ToIso8601());
+	Root->SetStringField(TEXT("engine"), FEngineVersion::Current().ToString());
+	Root->SetStringField(TEXT("build"), LexToString(FApp::GetBuildConfiguration()));
+	Root->SetStringField(TEXT("platform"), FPlatformProperties::IniPlatformName());
+	Root->SetStringField(TEXT("cpu"), FPlatformMisc::GetCPUBrand().TrimStartAndEnd());
+	Root->SetNumberField(TEXT("cores"), FPlatformMisc::NumberOfCoresIncludingHyperthreads());
+	Root->SetStringField(TEXT("format"), Format);
+	Root->SetStringField(TEXT("source"), Source);
+	Root->SetNumberField(TEXT("warmup_sec"), Options.WarmupSec);
+	Root->SetArrayField(TEXT("steps"), JsonSteps);
+
+	FString Json;
+	FJsonSerializer::Serialize(Root, TJsonWriterFactory<>::Create(&Json));
+
+	const bool bCsvOk = FFileHelper::SaveStringToFile(Csv, *(Base + TEXT(".csv")));
+	const bool bJsonOk = FFileHelper::SaveStringToFile(Json, *(Base + TEXT(".json")));
+	UE_LOG(LogTemp, Log, TEXT("[HUB] LoadTest: results %s.{csv,json}%s"), *Base, bCsvOk && bJsonOk ? TEXT("") : TEXT(" (write failed)"));
+}
+
+static void RunHubLoadTestCommand(const TArray<FString>& Args, UWorld* World)
+{
+	if (Args.Num() > 0 && Args[0].Equals(TEXT("stop"), ESearchCase::IgnoreCase))
+	{
+		GSWIHubLoadTest.Reset();
+		return;
+	}
+
+	UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+	USWIHubClientSubsystem* Hub = GI ? GI->GetSubsystem<USWIHubClientSubsystem>() : nullptr;
+	if (!Hub)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[HUB] No hub subsystem in this world"));
+		return;
+	}
+
+	const FString Cmd = FString::Join(Args, TEXT(" "));
+	FLoadTestOptions Options;
+
+	FString List;
+	TArray<FString> Parts;
+	if (FParse::Value(*Cmd, TEXT("devices="), List, /*bShouldStopOnSeparator=*/false))
+	{
+		List.ParseIntoArray(Parts, TEXT(","));
+		for (const FString& Part : Parts)
+		{
+			Options.DeviceCounts.Add(FMath::Clamp(FCString::Atoi(*Part), 1, 1024));
+		}
+	}
+	if (FParse::Value(*Cmd, TEXT("rate="), List, /*bShouldStopOnSeparator=*/false))
+	{
+		List.ParseIntoArray(Parts, TEXT(","));
+		for (const FString& Part : Parts)
+		{
+			Options.RatesHz.Add(FMath::Clamp(FCString::Atof(*Part), 1.f, 1000.f));
+		}
+	}
+	if (Options.DeviceCounts.Num() == 0) Options.DeviceCounts = { 1, 4, 16, 64, 256 };
+	if (Options.RatesHz.Num() == 0) Options.RatesHz = { 100.f };
+
+	FString Format;
+	if (FParse::Value(*Cmd, TEXT("format="), Format))
+	{
+		Options.bBinary = !Format.Equals(TEXT("json"), ESearchCase::IgnoreCase);
+	}
+	FParse::Value(*Cmd, TEXT("seconds="), Options.MeasureSec);
+	FParse::Value(*Cmd, TEXT("warmup="), Options.WarmupSec);
+	FParse::Value(*Cmd, TEXT("port="), Options.Port);
+	FParse::Value(*Cmd, TEXT("source="), Options.SourcePath);
+	FParse::Value(*Cmd, TEXT("out="), Options.OutDir);
+	FParse::Bool(*Cmd, TEXT("quit="), Options.bQuit);
+
+	Options.MeasureSec = FMath::Max(Options.MeasureSec, 1.0);
+	Options.WarmupSec = FMath::Max(Options.WarmupSec, 0.5);
+
+	// Replacing a running test aborts it (and restores the hub) before the new one starts.
+	GSWIHubLoadTest.Reset();
+	GSWIHubLoadTest = MakeUnique<FSWIHubLoadTestRunner>(World, Hub, MoveTemp(Options));
+}
+
+static FAutoConsoleCommandWithWorldAndArgs GSWIHubLoadTestCmd(
+	TEXT("SWI.Hub.LoadTest"),
+	TEXT("Stream synthetic/recorded IMU for N virtual phones through the hub client and write CSV/JSON results. ")
+	TEXT("Args: devices=1,16,64 rate=60,100 format=bin|json seconds=10 [warmup=2] [source=<path>] [port=18090] [out=<dir>] [quit=1] | stop"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&RunHubLoadTestCommand)
+);
+
+#endif // !UE_BUILD_SHIPPING
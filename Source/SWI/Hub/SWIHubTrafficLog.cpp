@@ -0,0 +1,406 @@
+#include "SWIHubTrafficLog.h"
+#include "SWIHubImuDecoder.h"
+#include "Dom/JsonObject.h"
+#include "HAL/FileManager.h"
+#include "Serialization/Archive.h"
+#include "Serialization/JsonReader.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+namespace
+{
+	static_assert(PLATFORM_LITTLE_ENDIAN, "Traffic recordings are written in host byte order.");
+
+	template<typename T>
+	void WritePod(FArchive& Ar, T Value)
+	{
+		Ar.Serialize(&Value, sizeof(T));
+	}
+
+	template<typename T>
+	T ReadPod(FArchive& Ar)
+	{
+		T Value{};
+		Ar.Serialize(&Value, sizeof(T));
+		return Value;
+	}
+
+	FString ReadUtf8(FArchive& Ar, int32 Len, TArray<uint8>& Scratch)
+	{
+		Scratch.SetNumUninitialized(Len, EAllowShrinking::No);
+		Ar.Serialize(Scratch.GetData(), Len);
+		const FUTF8ToTCHAR Conv(reinterpret_cast<const ANSICHAR*>(Scratch.GetData()), Len);
+		return FString(Conv.Length(), Conv.Get());
+	}
+}
+
+// ---- Recorder ----
+
+FSWIHubTrafficRecorder::~FSWIHubTrafficRecorder()
+{
+	Close();
+}
+
+bool FSWIHubTrafficRecorder::Open(const FString& InPath)
+{
+	Close();
+
+	Ar.Reset(IFileManager::Get().CreateFileWriter(*InPath));
+	if (!Ar.IsValid())
+	{
+		return false;
+	}
+
+	Path = InPath;
+	Devices.Reset();
+	NumFileDevices = 0;
+	StartTimeSec = -1.0;
+	NumRecords = 0;
+
+	WritePod<uint32>(*Ar, SWIHubTrafficFormat::Magic);
+	WritePod<uint16>(*Ar, SWIHubTrafficFormat::Version);
+	WritePod<uint16>(*Ar, 0);
+	return true;
+}
+
+void FSWIHubTrafficRecorder::Close()
+{
+	if (Ar.IsValid())
+	{
+		Ar->Close();
+		Ar.Reset();
+	}
+}
+
+void FSWIHubTrafficRecorder::WriteHeader(SWIHubTrafficFormat::EKind Kind, double LocalTimeSec)
+{
+	if (StartTimeSec < 0.0)
+	{
+		StartTimeSec = LocalTimeSec;
+	}
+	WritePod<uint8>(*Ar, static_cast<uint8>(Kind));
+	WritePod<double>(*Ar, LocalTimeSec - StartTimeSec);
+	++NumRecords;
+}
+
+void FSWIHubTrafficRecorder::WriteString(const FString& S)
+{
+	const FTCHARToUTF8 Utf8(*S);
+	const uint16 Len = static_cast<uint16>(FMath::Min(Utf8.Length(), 0xFFFF));
+	WritePod<uint16>(*Ar, Len);
+	Ar->Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Len);
+}
+
+void FSWIHubTrafficRecorder::WriteImu(const FSWIHubImuFrame& Frame, const FSWIHubDeviceHandles& Handles, double LocalTimeSec)
+{
+	if (!Ar.IsValid() || Frame.Device < 0) return;
+
+	if (Frame.Device >= Devices.Num())
+	{
+		Devices.SetNum(Frame.Device + 1);
+	}
+
+	FIdentity& Id = Devices[Frame.Device];
+	const uint32 Revision = Handles.GetRevision(Frame.Device);
+	if (Id.Index == INDEX_NONE || Id.Revision != Revision)
+	{
+		if (Id.Index == INDEX_NONE)
+		{
+			if (NumFileDevices > 0xFFFF) return;
+			Id.Index = NumFileDevices++;
+		}
+		Id.Revision = Revision;
+
+		FSWIHubDeviceIdentity Identity;
+		Handles.Resolve(Frame.Device, Identity);
+
+		WriteHeader(SWIHubTrafficFormat::EKind::Device, LocalTimeSec);
+		WritePod<uint16>(*Ar, static_cast<uint16>(Id.Index));
+		WriteString(Identity.Uid);
+		WriteString(Identity.Name);
+		WriteString(Identity.MatchId);
+	}
+
+	WriteHeader(SWIHubTrafficFormat::EKind::Imu, LocalTimeSec);
+	WritePod<uint16>(*Ar, static_cast<uint16>(Id.Index));
+	WritePod<double>(*Ar, Frame.TsMs);
+	WritePod<double>(*Ar, Frame.HubRxMs);
+	WritePod<double>(*Ar, Frame.HubTxMs);
+	for (const float V : { Frame.Yaw, Frame.Pitch, Frame.Roll, Frame.Ax, Frame.Ay, Frame.Az, Frame.Gx, Frame.Gy, Frame.Gz })
+	{
+		WritePod<float>(*Ar, V);
+	}
+	WritePod<uint32>(*Ar, static_cast<uint32>(Frame.Buttons));
+	WritePod<int64>(*Ar, Frame.Seq);
+}
+
+void FSWIHubTrafficRecorder::WriteControl(const FString& Json, double LocalTimeSec)
+{
+	if (!Ar.IsValid()) return;
+
+	const FTCHARToUTF8 Utf8(*Json);
+	WriteHeader(SWIHubTrafficFormat::EKind::Control, LocalTimeSec);
+	WritePod<uint32>(*Ar, static_cast<uint32>(Utf8.Length()));
+	Ar->Serialize(const_cast<ANSICHAR*>(Utf8.Get()), Utf8.Length());
+}
+
+// ---- Readers ----
+
+namespace
+{
+	class FBinaryTrafficReader final : public FSWIHubTrafficReader
+	{
+	public:
+		explicit FBinaryTrafficReader(TUniquePtr<FArchive>&& InAr) : Ar(MoveTemp(InAr)) {}
+
+		virtual bool Next(FSWIHubTrafficRecord& Out) override
+		{
+			using namespace SWIHubTrafficFormat;
+
+			while (!Ar->AtEnd() && !Ar->IsError())
+			{
+				const EKind Kind = static_cast<EKind>(ReadPod<uint8>(*Ar));
+				const double TimeSec = ReadPod<double>(*Ar);
+
+				switch (Kind)
+				{
+				case EKind::Device:
+				{
+					const uint16 Index = ReadPod<uint16>(*Ar);
+					FSWIHubDeviceIdentity& Id = Identities.FindOrAdd(Index);
+					Id.Uid = ReadUtf8(*Ar, ReadPod<uint16>(*Ar), Scratch);
+					Id.Name = ReadUtf8(*Ar, ReadPod<uint16>(*Ar), Scratch);
+					Id.MatchId = ReadUtf8(*Ar, ReadPod<uint16>(*Ar), Scratch);
+					continue;
+				}
+				case EKind::Imu:
+				{
+					const FSWIHubDeviceIdentity* Id = Identities.Find(ReadPod<uint16>(*Ar));
+					Out.Identity = Id ? *Id : FSWIHubDeviceIdentity();
+					FSWIHubImuFrame& F = Out.Frame;
+					F = FSWIHubImuFrame();
+					F.TsMs = ReadPod<double>(*Ar);
+					F.HubRxMs = ReadPod<double>(*Ar);
+					F.HubTxMs = ReadPod<double>(*Ar);
+					for (float* V : { &F.Yaw, &F.Pitch, &F.Roll, &F.Ax, &F.Ay, &F.Az, &F.Gx, &F.Gy, &F.Gz })
+					{
+						*V = ReadPod<float>(*Ar);
+					}
+					F.Buttons = static_cast<int32>(ReadPod<uint32>(*Ar));
+					F.Seq = ReadPod<int64>(*Ar);
+					SWIHubImuDecoder::ResolveButtons(F, true);
+
+					Out.Kind = FSWIHubTrafficRecord::EKind::Imu;
+					Out.TimeSec = TimeSec;
+					return !Ar->IsError();
+				}
+				case EKind::Control:
+				{
+					const uint32 Len = ReadPod<uint32>(*Ar);
+					if (Len > 16u * 1024u * 1024u) return false;
+					Out.Json = ReadUtf8(*Ar, static_cast<int32>(Len), Scratch);
+					Out.Kind = FSWIHubTrafficRecord::EKind::Control;
+					Out.TimeSec = TimeSec;
+					return !Ar->IsError();
+				}
+				default:
+					return false;
+				}
+			}
+			return false;
+		}
+
+		virtual bool Rewind() override
+		{
+			Identities.Reset();
+			Ar->Seek(8);
+			return !Ar->IsError();
+		}
+
+	private:
+		TUniquePtr<FArchive> Ar;
+		TMap<uint16, FSWIHubDeviceIdentity> Identities;
+		TArray<uint8> Scratch;
+	};
+
+	class FNdjsonTrafficReader final : public FSWIHubTrafficReader
+	{
+	public:
+		explicit FNdjsonTrafficReader(TUniquePtr<FArchive>&& InAr) : Ar(MoveTemp(InAr))
+		{
+			Chunk.SetNumUninitialized(ChunkSize);
+		}
+
+		virtual bool Next(FSWIHubTrafficRecord& Out) override
+		{
+			if (PopPending(Out)) return true;
+
+			FString Line;
+			while (ReadLine(Line))
+			{
+				if (ParseLine(Line) && PopPending(Out)) return true;
+			}
+
+			// End of log: every phone seen leaves.
+			for (const FString& Uid : Seen)
+			{
+				AddDeviceEvent(TEXT("device_disconnected"), Uid, FString(), LastTimeSec);
+			}
+			Seen.Reset();
+			return PopPending(Out);
+		}
+
+		virtual bool Rewind() override
+		{
+			Ar->Seek(0);
+			ChunkPos = ChunkLen = 0;
+			FirstServerTs = -1.0;
+			LastTimeSec = 0.0;
+			Seen.Reset();
+			Pending.Reset();
+			PendingHead = 0;
+			return !Ar->IsError();
+		}
+
+	private:
+		static constexpr int32 ChunkSize = 64 * 1024;
+
+		bool ReadLine(FString& Out)
+		{
+			LineBytes.Reset();
+			for (;;)
+			{
+				if (ChunkPos >= ChunkLen)
+				{
+					const int64 Remaining = Ar->TotalSize() - Ar->Tell();
+					if (Remaining <= 0)
+					{
+						break;
+					}
+					ChunkLen = static_cast<int32>(FMath::Min<int64>(Remaining, ChunkSize));
+					ChunkPos = 0;
+					Ar->Serialize(Chunk.GetData(), ChunkLen);
+				}
+
+				const uint8* Start = Chunk.GetData() + ChunkPos;
+				int32 Len = 0;
+				while (ChunkPos + Len < ChunkLen && Start[Len] != '\n') ++Len;
+				const bool bNewLine = ChunkPos + Len < ChunkLen;
+				LineBytes.Append(Start, Len);
+				ChunkPos += Len + (bNewLine ? 1 : 0);
+				if (bNewLine) break;
+			}
+
+			if (LineBytes.Num() == 0 && ChunkPos >= ChunkLen && Ar->Tell() >= Ar->TotalSize())
+			{
+				return false;
+			}
+
+			const FUTF8ToTCHAR Conv(reinterpret_cast<const ANSICHAR*>(LineBytes.GetData()), LineBytes.Num());
+			Out = FString(Conv.Length(), Conv.Get());
+			return true;
+		}
+
+		bool ParseLine(const FString& Line)
+		{
+			TSharedPtr<FJsonObject> Root;
+			if (!FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Line), Root) || !Root.IsValid()) return false;
+
+			FString Role;
+			Root->TryGetStringField(TEXT("role"), Role);
+			const TSharedPtr<FJsonObject>* Payload = nullptr;
+			if (Role != TEXT("phone") || !Root->TryGetObjectField(TEXT("payload"), Payload) || !Payload) return false;
+
+			FString Type;
+			(*Payload)->TryGetStringField(TEXT("type"), Type);
+			if (!Type.Equals(TEXT("imu"), ESearchCase::IgnoreCase)) return false;
+
+			double ServerTs = 0.0;
+			Root->TryGetNumberField(TEXT("server_ts"), ServerTs);
+			if (FirstServerTs < 0.0) FirstServerTs = ServerTs;
+			LastTimeSec = FMath::Max(LastTimeSec, ServerTs - FirstServerTs);
+
+			FSWIHubTrafficRecord Record;
+			Record.Kind = FSWIHubTrafficRecord::EKind::Imu;
+			Record.TimeSec = ServerTs - FirstServerTs;
+			SWIHubImuDecoder::DecodeFromJsonObject(*Payload, Record.Frame, Record.Identity);
+
+			// The hub takes identity from the connection (top-level uid/name), not the payload.
+			Root->TryGetStringField(TEXT("uid"), Record.Identity.Uid);
+			Root->TryGetStringField(TEXT("name"), Record.Identity.Name);
+			if (Record.Frame.HubRxMs <= 0.0) Record.Frame.HubRxMs = ServerTs * 1000.0;
+
+			if (!Seen.Contains(Record.Identity.Uid))
+			{
+				Seen.Add(Record.Identity.Uid);
+				AddDeviceEvent(TEXT("device_connected"), Record.Identity.Uid, Record.Identity.Name, Record.TimeSec);
+			}
+			Pending.Add(MoveTemp(Record));
+			return true;
+		}
+
+		void AddDeviceEvent(const TCHAR* Type, const FString& Uid, const FString& Name, double TimeSec)
+		{
+			const TSharedRef<FJsonObject> Msg = MakeShared<FJsonObject>();
+			Msg->SetStringField(TEXT("type"), Type);
+			Msg->SetStringField(TEXT("uid"), Uid);
+			Msg->SetStringField(TEXT("name"), Name);
+			Msg->SetStringField(TEXT("role"), TEXT("phone"));
+			Msg->SetStringField(TEXT("remote"), TEXT("replay"));
+
+			FSWIHubTrafficRecord& Record = Pending.AddDefaulted_GetRef();
+			Record.Kind = FSWIHubTrafficRecord::EKind::Control;
+			Record.TimeSec = TimeSec;
+			FJsonSerializer::Serialize(Msg, TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Record.Json));
+		}
+
+		bool PopPending(FSWIHubTrafficRecord& Out)
+		{
+			if (PendingHead >= Pending.Num())
+			{
+				Pending.Reset();
+				PendingHead = 0;
+				return false;
+			}
+			Out = MoveTemp(Pending[PendingHead++]);
+			return true;
+		}
+
+		TUniquePtr<FArchive> Ar;
+		TArray<uint8> Chunk;
+		int32 ChunkPos = 0;
+		int32 ChunkLen = 0;
+		TArray<uint8> LineBytes;
+
+		double FirstServerTs = -1.0;
+		double LastTimeSec = 0.0;
+		TSet<FString> Seen;
+		TArray<FSWIHubTrafficRecord> Pending;
+		int32 PendingHead = 0;
+	};
+}
+
+TUniquePtr<FSWIHubTrafficReader> FSWIHubTrafficReader::Open(const FString& Path)
+{
+	TUniquePtr<FArchive> Ar(IFileManager::Get().CreateFileReader(*Path));
+	if (!Ar.IsValid())
+	{
+		return nullptr;
+	}
+
+	if (Ar->TotalSize() >= 8)
+	{
+		const uint32 Magic = ReadPod<uint32>(*Ar);
+		const uint16 Version = ReadPod<uint16>(*Ar);
+		ReadPod<uint16>(*Ar);
+		if (Magic == SWIHubTrafficFormat::Magic)
+		{
+			if (Version != SWIHubTrafficFormat::Version) return nullptr;
+			return MakeUnique<FBinaryTrafficReader>(MoveTemp(Ar));
+		}
+	}
+
+	Ar->Seek(0);
+	return MakeUnique<FNdjsonTrafficReader>(MoveTemp(Ar));
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "SWI/SWIHubProtocolTypes.h"
+#include "SWI/Hub/SWIHubDeviceHandles.h"
+
+class FArchive;
+
+/**
+ * Compact binary capture of what the hub client ingested (".swirec").
+ *
+ * Header: "SWIR", u16 Version, u16 Reserved. Then records, each u8 Kind + f64 TimeSec (since the first record):
+ *   Device  (1): u16 Index, Uid, Name, MatchId           (strings: u16 byte length + UTF-8)
+ *   Imu     (2): u16 Index, f64 TsMs HubRxMs HubTxMs, f32 Yaw Pitch Roll Ax Ay Az Gx Gy Gz,
+ *                u32 Buttons, i64 Seq
+ *   Control (3): u32 byte length + UTF-8 JSON
+ * A Device record is written whenever a device's identity first appears or changes, so IMU records stay 83 bytes.
+ */
+namespace SWIHubTrafficFormat
+{
+	inline constexpr uint32 Magic = 'S' | ('W' << 8) | ('I' << 16) | ('R' << 24);
+	inline constexpr uint16 Version = 1;
+
+	enum class EKind : uint8
+	{
+		Device = 1,
+		Imu = 2,
+		Control = 3,
+	};
+}
+
+struct FSWIHubTrafficRecord
+{
+	enum class EKind : uint8 { Imu, Control };
+
+	EKind Kind = EKind::Imu;
+	double TimeSec = 0.0;
+	FSWIHubImuFrame Frame;			// Device not set: the replayer interns Identity
+	FSWIHubDeviceIdentity Identity;
+	FString Json;
+};
+
+// Game thread. Writes through a buffered file archive; nothing is held in memory beyond its buffer.
+class SWI_API FSWIHubTrafficRecorder
+{
+public:
+	~FSWIHubTrafficRecorder();
+
+	bool Open(const FString& Path);
+	void Close();
+	bool IsOpen() const { return Ar.IsValid(); }
+
+	// Handles resolves Frame.Device; only read when the device is new to the file or its identity changed.
+	void WriteImu(const FSWIHubImuFrame& Frame, const FSWIHubDeviceHandles& Handles, double LocalTimeSec);
+	void WriteControl(const FString& Json, double LocalTimeSec);
+
+	const FString& GetPath() const { return Path; }
+	uint64 GetNumRecords() const { return NumRecords; }
+
+private:
+	struct FIdentity
+	{
+		int32 Index = INDEX_NONE;	// device index in the file
+		uint32 Revision = 0;		// FSWIHubDeviceHandles revision last written
+	};
+
+	void WriteHeader(SWIHubTrafficFormat::EKind Kind, double LocalTimeSec);
+	void WriteString(const FString& S);
+
+	TUniquePtr<FArchive> Ar;
+	FString Path;
+	TArray<FIdentity> Devices;		// by device handle
+	int32 NumFileDevices = 0;
+	double StartTimeSec = -1.0;
+	uint64 NumRecords = 0;
+};
+
+/**
+ * Streams a recording record by record: either a .swirec from FSWIHubTrafficRecorder or the hub's gyro_log.ndjson.
+ * Reads through a fixed-size buffer, so files of any length replay in constant memory.
+ *
+ * NDJSON: phone "imu" payloads become frames timed by server_ts (which also stands in for hub_rx). The hub log has
+ * no UE-side control traffic, so device_connected is synthesized at a device's first frame and device_disconnected
+ * at the end of the file.
+ */
+class SWI_API FSWIHubTrafficReader
+{
+public:
+	virtual ~FSWIHubTrafficReader() = default;
+
+	static TUniquePtr<FSWIHubTrafficReader> Open(const FString& Path);
+
+	// False at end of file (or on a truncated record).
+	virtual bool Next(FSWIHubTrafficRecord& Out) = 0;
+	virtual bool Rewind() = 0;
+};
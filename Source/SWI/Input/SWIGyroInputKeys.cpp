@@ -0,0 +1,31 @@
+#include "SWIGyroInputKeys.h"
+
+#define LOCTEXT_NAMESPACE "SWIGyroKeys"
+
+const FKey FSWIGyroKeys::MoveX("SWI_Gyro_MoveX");
+const FKey FSWIGyroKeys::MoveY("SWI_Gyro_MoveY");
+const FKey FSWIGyroKeys::Move2D("SWI_Gyro_Move2D");
+
+const FKey FSWIGyroKeys::LookX("SWI_Gyro_LookX");
+const FKey FSWIGyroKeys::LookY("SWI_Gyro_LookY");
+const FKey FSWIGyroKeys::Look2D("SWI_Gyro_Look2D");
+
+const FKey FSWIGyroKeys::Fire("SWI_Gyro_Fire");
+
+void FSWIGyroKeys::Register()
+{
+	static const FName MenuCategory = TEXT("SWIGyro");
+	EKeys::AddMenuCategoryDisplayInfo(MenuCategory, LOCTEXT("Category", "SWI Gyro"), TEXT("GraphEditor.PadEvent_16x"));
+
+	EKeys::AddKey(FKeyDetails(MoveX, LOCTEXT("MoveX", "Gyro Move X"), FKeyDetails::Axis1D, MenuCategory));
+	EKeys::AddKey(FKeyDetails(MoveY, LOCTEXT("MoveY", "Gyro Move Y"), FKeyDetails::Axis1D, MenuCategory));
+	EKeys::AddPairedKey(FKeyDetails(Move2D, LOCTEXT("Move2D", "Gyro Move 2D"), FKeyDetails::Axis2D, MenuCategory), MoveX, MoveY);
+
+	EKeys::AddKey(FKeyDetails(LookX, LOCTEXT("LookX", "Gyro Look X"), FKeyDetails::Axis1D, MenuCategory));
+	EKeys::AddKey(FKeyDetails(LookY, LOCTEXT("LookY", "Gyro Look Y"), FKeyDetails::Axis1D, MenuCategory));
+	EKeys::AddPairedKey(FKeyDetails(Look2D, LOCTEXT("Look2D", "Gyro Look 2D"), FKeyDetails::Axis2D, MenuCategory), LookX, LookY);
+
+	EKeys::AddKey(FKeyDetails(Fire, LOCTEXT("Fire", "Gyro Fire"), FKeyDetails::NoFlags, MenuCategory));
+}
+
+#undef LOCTEXT_NAMESPACE
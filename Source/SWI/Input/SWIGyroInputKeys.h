@@ -0,0 +1,26 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InputCoreTypes.h"
+
+/**
+ * Phone gyro as input keys, so Input Mapping Contexts can bind it like a gamepad.
+ *
+ * Move is a stick (X = right, Y = forward, -1..1). Look is a per-frame delta like the mouse, already in
+ * AddYawInput / AddPitchInput units. Fire is button bit 0. ASWIPlayerController injects them once per frame.
+ */
+struct SWI_API FSWIGyroKeys
+{
+	static const FKey MoveX;
+	static const FKey MoveY;
+	static const FKey Move2D;
+
+	static const FKey LookX;
+	static const FKey LookY;
+	static const FKey Look2D;
+
+	static const FKey Fire;
+
+	// Module startup, before any mapping context is loaded.
+	static void Register();
+};
@@ -0,0 +1,28 @@
+#include "SWIGyroPawnInput.h"
+#include "GameFramework/Pawn.h"
+
+void SWIGyroPawnInput::ApplyMove(APawn* Pawn, const FRotator& ControlRotation, const FVector2D& Stick, float Scale, bool bByControlYaw)
+{
+	const float Forward = Stick.Y * Scale;
+	const float Right = Stick.X * Scale;
+
+	if (!Pawn || (FMath::IsNearlyZero(Forward) && FMath::IsNearlyZero(Right)))
+		return;
+
+	FVector ForwardDir, RightDir;
+
+	if (bByControlYaw)
+	{
+		const FRotator YawOnly(0.f, ControlRotation.Yaw, 0.f);
+		ForwardDir = FRotationMatrix(YawOnly).GetUnitAxis(EAxis::X);
+		RightDir = FRotationMatrix(YawOnly).GetUnitAxis(EAxis::Y);
+	}
+	else
+	{
+		ForwardDir = Pawn->GetActorForwardVector();
+		RightDir = Pawn->GetActorRightVector();
+	}
+
+	Pawn->AddMovementInput(ForwardDir, Forward, /*bForce=*/true);
+	Pawn->AddMovementInput(RightDir, Right,   /*bForce=*/true);
+}
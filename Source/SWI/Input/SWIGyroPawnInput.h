@@ -0,0 +1,12 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+class APawn;
+
+// Applies gyro stick input to a pawn; shared by the player and phone controllers.
+namespace SWIGyroPawnInput
+{
+	// Stick convention: X = right, Y = forward. Directions follow the control yaw, or the pawn's facing.
+	SWI_API void ApplyMove(APawn* Pawn, const FRotator& ControlRotation, const FVector2D& Stick, float Scale, bool bByControlYaw);
+}
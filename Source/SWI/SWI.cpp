@@ -2,5 +2,15 @@
 
 #include "SWI.h"
 #include "Modules/ModuleManager.h"
+#include "SWI/Input/SWIGyroInputKeys.h"
 
-IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, SWI, "SWI" );
+class FSWIModule : public FDefaultGameModuleImpl
+{
+public:
+	virtual void StartupModule() override
+	{
+		FSWIGyroKeys::Register();
+	}
+};
+
+IMPLEMENT_PRIMARY_GAME_MODULE( FSWIModule, SWI, "SWI" );
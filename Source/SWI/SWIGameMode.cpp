@@ -1,8 +1,17 @@
 #include "SWIGameMode.h"
 #include "SWI/Subsystems/SWIHubServiceSubsystem.h"
+#include "SWI/SWIPlayerController.h"
+#include "SWI/SWIPhoneController.h"
+#include "SWI/Components/SWIGyroInputReceiverComponent.h"
+#include "Engine/GameInstance.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerState.h"
+#include "Kismet/GameplayStatics.h"
 
 ASWIGameMode::ASWIGameMode()
 {
+	PhoneControllerClass = ASWIPhoneController::StaticClass();
 }
 
 void ASWIGameMode::BeginPlay()
@@ -13,13 +22,40 @@ void ASWIGameMode::BeginPlay()
 
 	if(UGameInstance* GI = GetGameInstance())
 	{
-		//Hub = GI->GetSubsystem<USWIHubClientSubsystem>();
-		//if (Hub)
-		//{
-		//	Hub->OnDeviceConnected().AddUObject(this, &ThisClass::HandleDeviceConnected);
-		//	Hub->OnDeviceDisconnected().AddUObject(this, &ThisClass::HandleDeviceDisconnected);
-		//}
+		Hub = GI->GetSubsystem<USWIHubClientSubsystem>();
+		if (Hub)
+		{
+			//Hub->OnDeviceConnected().AddUObject(this, &ThisClass::HandleDeviceConnected);
+			//Hub->OnDeviceDisconnected().AddUObject(this, &ThisClass::HandleDeviceDisconnected);
+			Hub->OnMatchStart.AddDynamic(this, &ThisClass::HandleMatchStart);
+			Hub->OnMatchEnd.AddDynamic(this, &ThisClass::HandleMatchEnd);
+
+			// 매치 도중 맵이 바뀐 경우
+			for (const FHubMatchStart& Match : Hub->GetActiveMatches())
+			{
+				SpawnPhonePlayers(Match);
+			}
+		}
+	}
+}
+
+void ASWIGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (Hub)
+	{
+		Hub->OnMatchStart.RemoveDynamic(this, &ThisClass::HandleMatchStart);
+		Hub->OnMatchEnd.RemoveDynamic(this, &ThisClass::HandleMatchEnd);
+	}
+	Super::EndPlay(EndPlayReason);
+}
+
+UClass* ASWIGameMode::GetDefaultPawnClassForController_Implementation(AController* InController)
+{
+	if (PhonePawnClass && Cast<ASWIPhoneController>(InController))
+	{
+		return PhonePawnClass;
 	}
+	return Super::GetDefaultPawnClassForController_Implementation(InController);
 }
 
 void ASWIGameMode::ReportMatchResultToHub(const FString& WinnerUid, const TArray<FSWIHubPlayerResultRow>& Results, int32 DurationSec)
@@ -33,3 +69,139 @@ void ASWIGameMode::HandleDeviceConnected(const FSWIHubDeviceInfo& Device)
 void ASWIGameMode::HandleDeviceDisconnected(const FSWIHubDeviceInfo& Device)
 {
 }
+
+void ASWIGameMode::HandleMatchStart(const FHubMatchStart& Match)
+{
+	SpawnPhonePlayers(Match);
+}
+
+void ASWIGameMode::HandleMatchEnd(const FString& MatchId)
+{
+	ReleasePhonePlayers(MatchId);
+}
+
+void ASWIGameMode::SpawnPhonePlayers(const FHubMatchStart& Match)
+{
+	// A repeated match_start (hub reconnect) starts that match over; other matches keep their players.
+	ReleasePhonePlayers(Match.MatchId);
+
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	FSWIPhoneMatchPlayers& Players = PhoneMatches.Add(Match.MatchId);
+
+	// Slot i = players[i] of match_start; the hub routes that phone's IMU to whichever receiver holds (match, slot).
+	for (int32 Slot = 0; Slot < Match.Players.Num(); ++Slot)
+	{
+		const FString& Name = Match.Players[Slot].Name;
+
+		if (ASWIPlayerController* SWIPC = AcquireLocalController(Players))
+		{
+			AssignSlot(SWIPC, SWIPC->GetGyroReceiver(), Match.MatchId, Slot, Name);
+			continue;
+		}
+		// No local player free (limit reached, viewport limit, or not our controller class): a pawn takes it.
+
+		FActorSpawnParameters Params;
+		Params.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		ASWIPhoneController* PhoneController = World->SpawnActor<ASWIPhoneController>(
+			PhoneControllerClass ? *PhoneControllerClass : ASWIPhoneController::StaticClass(), Params);
+		if (!PhoneController) continue;
+
+		Players.PhoneControllers.Add(PhoneController);
+		RestartPlayer(PhoneController);
+		AssignSlot(PhoneController, PhoneController->GetGyroReceiver(), Match.MatchId, Slot, Name);
+	}
+
+	Players.NumPlayers = Match.Players.Num();
+	NumPhonePlayers += Players.NumPlayers;
+	UE_LOG(LogTemp, Log, TEXT("[GM] match %s: %d phones, %d local players, %d phone pawns (%d matches, %d phones)"),
+		*Match.MatchId, Players.NumPlayers, Players.LocalControllers.Num(), Players.PhoneControllers.Num(),
+		PhoneMatches.Num(), NumPhonePlayers);
+}
+
+ASWIPlayerController* ASWIGameMode::AcquireLocalController(FSWIPhoneMatchPlayers& Players)
+{
+	int32 NumInUse = 0;
+	for (const TPair<FString, FSWIPhoneMatchPlayers>& Pair : PhoneMatches)
+	{
+		NumInUse += Pair.Value.LocalControllers.Num();
+	}
+	if (NumInUse >= MaxLocalPhonePlayers) return nullptr;
+
+	UWorld* World = GetWorld();
+	UGameInstance* GI = GetGameInstance();
+	if (!World || !GI) return nullptr;
+
+	// A local player no match has a slot on.
+	for (ULocalPlayer* LP : GI->GetLocalPlayers())
+	{
+		ASWIPlayerController* SWIPC = LP ? Cast<ASWIPlayerController>(LP->GetPlayerController(World)) : nullptr;
+		USWIGyroInputReceiverComponent* Receiver = SWIPC ? SWIPC->GetGyroReceiver() : nullptr;
+		if (Receiver && Receiver->PlayerSlot == INDEX_NONE)
+		{
+			Players.LocalControllers.Add(SWIPC);
+			return SWIPC;
+		}
+	}
+
+	APlayerController* PC = UGameplayStatics::CreatePlayer(this, -1, /*bSpawnPlayerController=*/true);
+	if (!PC) return nullptr;
+
+	Players.CreatedLocalControllers.Add(PC);
+	ASWIPlayerController* SWIPC = Cast<ASWIPlayerController>(PC);
+	if (SWIPC)
+	{
+		Players.LocalControllers.Add(SWIPC);
+	}
+	return SWIPC;
+}
+
+void ASWIGameMode::AssignSlot(AController* Controller, USWIGyroInputReceiverComponent* Receiver, const FString& MatchId, int32 Slot, const FString& Name)
+{
+	if (Receiver)
+	{
+		Receiver->SetMatchSlot(MatchId, Slot);
+	}
+	if (Controller->PlayerState && !Name.IsEmpty())
+	{
+		Controller->PlayerState->SetPlayerName(Name);
+	}
+}
+
+void ASWIGameMode::ReleasePhonePlayers(const FString& MatchId)
+{
+	FSWIPhoneMatchPlayers Players;
+	if (!PhoneMatches.RemoveAndCopyValue(MatchId, Players)) return;
+
+	for (ASWIPhoneController* PhoneController : Players.PhoneControllers)
+	{
+		if (!IsValid(PhoneController)) continue;
+		if (APawn* P = PhoneController->GetPawn())
+		{
+			P->Destroy();
+		}
+		PhoneController->Destroy();
+	}
+
+	for (APlayerController* PC : Players.CreatedLocalControllers)
+	{
+		if (IsValid(PC))
+		{
+			UGameplayStatics::RemovePlayer(PC, /*bDestroyPawn=*/true);
+		}
+	}
+
+	// Borrowed local players go back to their own device binding (uid, or the next unrouted phone).
+	for (ASWIPlayerController* SWIPC : Players.LocalControllers)
+	{
+		if (!IsValid(SWIPC) || Players.CreatedLocalControllers.Contains(SWIPC)) continue;
+		if (USWIGyroInputReceiverComponent* Receiver = SWIPC->GetGyroReceiver())
+		{
+			Receiver->SetMatchSlot(FString(), INDEX_NONE);
+		}
+	}
+
+	NumPhonePlayers -= Players.NumPlayers;
+	UE_LOG(LogTemp, Log, TEXT("[GM] match %s released (%d matches, %d phones)"), *MatchId, PhoneMatches.Num(), NumPhonePlayers);
+}
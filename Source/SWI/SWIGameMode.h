@@ -5,6 +5,30 @@
 #include "SWI/SWIHubProtocolTypes.h"
 #include "SWIGameMode.generated.h"
 
+class APlayerController;
+class ASWIPhoneController;
+class USWIGyroInputReceiverComponent;
+class ASWIPlayerController;
+
+// Controllers that one hub match put into this game.
+USTRUCT()
+struct FSWIPhoneMatchPlayers
+{
+	GENERATED_BODY()
+
+	// Local players driven by this match's phones, created or borrowed.
+	UPROPERTY()
+	TArray<TObjectPtr<ASWIPlayerController>> LocalControllers;
+
+	// Local players created for this match (index 0 is the game's own and stays).
+	UPROPERTY()
+	TArray<TObjectPtr<APlayerController>> CreatedLocalControllers;
+
+	UPROPERTY()
+	TArray<TObjectPtr<ASWIPhoneController>> PhoneControllers;
+
+	int32 NumPlayers = 0;
+};
 
 UCLASS()
 class SWI_API ASWIGameMode : public AGameModeBase
@@ -15,15 +39,49 @@ public:
     ASWIGameMode();
 
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    virtual UClass* GetDefaultPawnClassForController_Implementation(AController* InController) override;
 
     UFUNCTION(BlueprintCallable, Category = "Hub|Match")
     void ReportMatchResultToHub(const FString& WinnerUid, const TArray<FSWIHubPlayerResultRow>& Results, int32 DurationSec);
 
+    // Phones get local players (split screen) until MaxLocalPhonePlayers are in use across all matches, the rest a pawn
+    // driven by a phone controller. Local players beyond what the viewport supports also fall back to pawns.
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Hub|Match", meta = (ClampMin = "1"))
+    int32 MaxLocalPhonePlayers = 4;
+
+    UPROPERTY(EditAnywhere, Category = "Hub|Match")
+    TSubclassOf<ASWIPhoneController> PhoneControllerClass;
+
+    // Pawn for phone controllers. Empty = DefaultPawnClass.
+    UPROPERTY(EditAnywhere, Category = "Hub|Match")
+    TSubclassOf<APawn> PhonePawnClass;
+
+    UFUNCTION(BlueprintPure, Category = "Hub|Match")
+    int32 GetNumPhonePlayers() const { return NumPhonePlayers; }
+
 private:
 	void HandleDeviceConnected(const FSWIHubDeviceInfo& Device);
 	void HandleDeviceDisconnected(const FSWIHubDeviceInfo& Device);
 
+	UFUNCTION()
+	void HandleMatchStart(const FHubMatchStart& Match);
+
+	UFUNCTION()
+	void HandleMatchEnd(const FString& MatchId);
+
+	void SpawnPhonePlayers(const FHubMatchStart& Match);
+	void ReleasePhonePlayers(const FString& MatchId);
+	ASWIPlayerController* AcquireLocalController(FSWIPhoneMatchPlayers& Players);
+	void AssignSlot(AController* Controller, USWIGyroInputReceiverComponent* Receiver, const FString& MatchId, int32 Slot, const FString& Name);
+
 private:
     UPROPERTY()
     class USWIHubClientSubsystem* Hub = nullptr;
+
+    // By match_id. The hub runs several matches at once; each comes and goes on its own.
+    UPROPERTY()
+    TMap<FString, FSWIPhoneMatchPlayers> PhoneMatches;
+
+    int32 NumPhonePlayers = 0;
 };
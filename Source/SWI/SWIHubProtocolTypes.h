@@ -4,6 +4,25 @@
 #include "SWIHubProtocolTypes.generated.h"
 
 
+// How the hub client folds a device's queued IMU frames within one tick.
+UENUM(BlueprintType)
+enum class ESWIHubImuCoalescing : uint8
+{
+    Off,        // dispatch every frame
+    OnBacklog,  // fold a device's frames only when more than the threshold arrived in one tick (after a hitch)
+    Always,     // one folded frame per device per tick, plus one per button change
+};
+
+UENUM(BlueprintType)
+enum class ESWIHubConnectionState : uint8
+{
+    Stopped,        // hub not started
+    Connecting,     // first attempt
+    Connected,
+    Degraded,       // connected, but pongs / traffic are late or RTT is high
+    Reconnecting,   // lost; waiting out the backoff or trying the next hub URL
+};
+
 USTRUCT(BlueprintType)
 struct FSWIHubDeviceInfo
 {
@@ -39,6 +58,10 @@ struct FSWIHubImuFrame
 {
     GENERATED_BODY()
 
+    // Session-stable device handle; uid, name and match id resolve through USWIHubClientSubsystem::GetDeviceUid etc.
+    UPROPERTY(BlueprintReadOnly) int32 Device = INDEX_NONE;
+
+    // Filled only on frames handed to Blueprints (OnImuFrame, GetLatestImu); native frames carry just the handle.
     UPROPERTY(BlueprintReadOnly) FString MatchId;
     UPROPERTY(BlueprintReadOnly) FString Uid;
     UPROPERTY(BlueprintReadOnly) FString Name;
@@ -57,7 +80,26 @@ struct FSWIHubImuFrame
     UPROPERTY(BlueprintReadOnly) float Gy = 0;
     UPROPERTY(BlueprintReadOnly) float Gz = 0;
 
+    // Per-device packet counter from the phone (1, 2, ...). 0 = the sender does not number its packets.
+    UPROPERTY(BlueprintReadOnly) int64 Seq = 0;
+
+    // Button level state, bit 0 = fire. Fire mirrors bit 0 for senders and Blueprints that predate the bitmask.
+    UPROPERTY(BlueprintReadOnly) int32 Buttons = 0;
     UPROPERTY(BlueprintReadOnly) int32 Fire = 0;
+
+    // Hub wall clock (Unix ms) when it received the phone packet / forwarded it. 0 = hub did not stamp.
+    UPROPERTY(BlueprintReadOnly) double HubRxMs = 0.0;
+    UPROPERTY(BlueprintReadOnly) double HubTxMs = 0.0;
+
+    // Local FPlatformTime::Seconds() when the socket callback received the packet.
+    UPROPERTY(BlueprintReadOnly) double RecvTimeSec = 0.0;
+
+    // Local FPlatformTime::Seconds() when the game thread dequeued it.
+    UPROPERTY(BlueprintReadOnly) double DequeueTimeSec = 0.0;
+
+    // Phone samples folded into this frame by the client's coalescer (1 = not coalesced). When > 1, Gx/Gy/Gz are the
+    // time-weighted mean rate since the previously delivered frame and Seq is the newest folded sample's.
+    UPROPERTY(BlueprintReadOnly) int32 NumSamples = 1;
 };
 
 USTRUCT(BlueprintType)
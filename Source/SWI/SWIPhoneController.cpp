@@ -0,0 +1,90 @@
+#include "SWIPhoneController.h"
+#include "SWI/Components/SWIGyroInputReceiverComponent.h"
+#include "SWI/Input/SWIGyroPawnInput.h"
+#include "SWI/Character/SWICharacterMovementComponent.h"
+#include "SWI/GameplayAbilities/SWIAbilitySystemComponent.h"
+#include "SWI/GameplayAbilities/SWIGameplayTags.h"
+#include "AbilitySystemGlobals.h"
+#include "GameFramework/Pawn.h"
+
+ASWIPhoneController::ASWIPhoneController()
+{
+	PrimaryActorTick.bCanEverTick = true;
+	bWantsPlayerState = true;
+	GyroReceiver = CreateDefaultSubobject<USWIGyroInputReceiverComponent>(TEXT("GyroReceiver"));
+	// Phone controllers exist for the many-phone case, so their math shares the hub's batched pass.
+	GyroReceiver->bBatchedMath = true;
+}
+
+void ASWIPhoneController::BeginPlay()
+{
+	Super::BeginPlay();
+
+	if (GyroReceiver)
+	{
+		GyroReceiver->OnButtonPressed.AddDynamic(this, &ThisClass::HandleGyroButtonPressed);
+		GyroReceiver->OnButtonReleased.AddDynamic(this, &ThisClass::HandleGyroButtonReleased);
+	}
+}
+
+void ASWIPhoneController::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	APawn* P = GetPawn();
+	if (!P || !GyroReceiver)
+	{
+		return;
+	}
+
+	// Server-side pawn: activations run locally, one per ability per frame however many presses came in.
+	if (USWIAbilitySystemComponent* ASC = Cast<USWIAbilitySystemComponent>(UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(P)))
+	{
+		ASC->ProcessAbilityInput();
+	}
+
+	FVector2D MoveAxis(0, 0), LookAxis(0, 0);
+	const bool bHasGyro = GyroReceiver->ConsumeIAValues(DeltaSeconds, MoveAxis, LookAxis);
+
+	if (USWICharacterMovementComponent* Move = Cast<USWICharacterMovementComponent>(P->GetMovementComponent()))
+	{
+		Move->SetGyroInput(bHasGyro);
+	}
+
+	if (!bHasGyro)
+	{
+		return;
+	}
+
+	// Same units as ASWIPlayerController's AddYawInput / AddPitchInput, applied straight to the control rotation.
+	FRotator ControlRot = GetControlRotation();
+	ControlRot.Yaw = FRotator::NormalizeAxis(ControlRot.Yaw + LookAxis.X);
+	ControlRot.Pitch = FMath::Clamp(FRotator::NormalizeAxis(ControlRot.Pitch + LookAxis.Y), MinViewPitch, MaxViewPitch);
+	SetControlRotation(ControlRot);
+	P->FaceRotation(ControlRot, DeltaSeconds);
+
+	// Receiver convention is X = forward, Y = right.
+	SWIGyroPawnInput::ApplyMove(P, ControlRot, FVector2D(MoveAxis.Y, MoveAxis.X), MoveScale, bMoveByControlYaw);
+
+	GyroReceiver->NotifyInputApplied();
+}
+
+void ASWIPhoneController::HandleGyroButtonPressed(int32 Button)
+{
+	if (Button != 0 || !bFireActivatesAbilities) return;
+
+	if (USWIAbilitySystemComponent* ASC = Cast<USWIAbilitySystemComponent>(UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(GetPawn())))
+	{
+		ASC->AbilityInputTagPressed(SWIGameplayTags::Input_Gyro_Fire);
+	}
+}
+
+void ASWIPhoneController::HandleGyroButtonReleased(int32 Button, float HeldSec)
+{
+	if (Button != 0 || !bFireActivatesAbilities) return;
+
+	if (USWIAbilitySystemComponent* ASC = Cast<USWIAbilitySystemComponent>(UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(GetPawn())))
+	{
+		ASC->AbilityInputTagReleased(SWIGameplayTags::Input_Gyro_Fire);
+	}
+}
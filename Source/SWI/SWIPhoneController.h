@@ -0,0 +1,52 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Controller.h"
+#include "SWIPhoneController.generated.h"
+
+class USWIGyroInputReceiverComponent;
+
+/**
+ * Drives one pawn from one phone, without a local player or viewport.
+ * The game mode spawns one per match slot beyond the split-screen players, so a shared screen scales to many phones.
+ */
+UCLASS()
+class SWI_API ASWIPhoneController : public AController
+{
+	GENERATED_BODY()
+
+public:
+	ASWIPhoneController();
+
+	virtual void BeginPlay() override;
+	virtual void Tick(float DeltaSeconds) override;
+
+	USWIGyroInputReceiverComponent* GetGyroReceiver() const { return GyroReceiver; }
+
+protected:
+	UPROPERTY(VisibleAnywhere, Category = "Gyro|Refs")
+	TObjectPtr<USWIGyroInputReceiverComponent> GyroReceiver = nullptr;
+
+	UPROPERTY(EditAnywhere, Category = "Gyro|Move")
+	float MoveScale = 1.0f;
+
+	UPROPERTY(EditAnywhere, Category = "Gyro|Move")
+	bool bMoveByControlYaw = true;
+
+	UPROPERTY(EditAnywhere, Category = "Gyro|Look")
+	float MinViewPitch = -89.f;
+
+	UPROPERTY(EditAnywhere, Category = "Gyro|Look")
+	float MaxViewPitch = 89.f;
+
+	// Fire presses Input.Gyro.Fire on the pawn's ability system.
+	UPROPERTY(EditAnywhere, Category = "Gyro|Input")
+	bool bFireActivatesAbilities = true;
+
+private:
+	UFUNCTION()
+	void HandleGyroButtonPressed(int32 Button);
+
+	UFUNCTION()
+	void HandleGyroButtonReleased(int32 Button, float HeldSec);
+};
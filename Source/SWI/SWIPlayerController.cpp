@@ -1,8 +1,18 @@
 #include "SWIPlayerController.h"
 #include "SWI/Components/SWIGyroInputReceiverComponent.h"
+#include "SWI/Input/SWIGyroInputKeys.h"
+#include "EnhancedInputComponent.h"
+#include "EnhancedInputSubsystems.h"
+#include "InputAction.h"
+#include "InputMappingContext.h"
+#include "Engine/LocalPlayer.h"
+#include "SWI/Input/SWIGyroPawnInput.h"
+#include "SWI/Character/SWICharacterMovementComponent.h"
+#include "SWI/GameplayAbilities/SWIAbilitySystemComponent.h"
+#include "SWI/GameplayAbilities/SWIGameplayTags.h"
+#include "AbilitySystemGlobals.h"
 #include "GameFramework/Pawn.h"
-#include "GameFramework/Character.h"
-#include "GameFramework/CharacterMovementComponent.h"
+#include "GenericPlatform/GenericPlatformInputDeviceMapper.h"
 
 ASWIPlayerController::ASWIPlayerController()
 {
@@ -17,70 +27,192 @@ void ASWIPlayerController::BeginPlay()
 	SetIgnoreMoveInput(false);
 	SetIgnoreLookInput(false);
 
+	if (IsLocalController())
+	{
+		// The phone is its own input device of this player, next to keyboard / gamepad.
+		IPlatformInputDeviceMapper& Mapper = IPlatformInputDeviceMapper::Get();
+		GyroInputDevice = Mapper.AllocateNewInputDeviceId();
+		Mapper.Internal_MapInputDeviceToUser(GyroInputDevice, GetPlatformUserId(), EInputDeviceConnectionState::Connected);
+
+		EnsureGyroInputAssets();
+		if (UEnhancedInputLocalPlayerSubsystem* Input = ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(GetLocalPlayer()))
+		{
+			Input->AddMappingContext(GyroMappingContext, GyroMappingPriority);
+		}
+	}
+
+	if (GyroReceiver)
+	{
+		GyroReceiver->OnButtonPressed.AddDynamic(this, &ThisClass::HandleGyroButtonPressed);
+		GyroReceiver->OnButtonReleased.AddDynamic(this, &ThisClass::HandleGyroButtonReleased);
+	}
+
 	UE_LOG(LogTemp, Log, TEXT("[PC] BeginPlay IgnoreMove=%d IgnoreLook=%d Pawn=%s"),
 		IsMoveInputIgnored() ? 1 : 0,
 		IsLookInputIgnored() ? 1 : 0,
 		*GetNameSafe(GetPawn()));
 }
 
+void ASWIPlayerController::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (GyroInputDevice != INPUTDEVICEID_NONE)
+	{
+		IPlatformInputDeviceMapper::Get().Internal_SetInputDeviceConnectionState(GyroInputDevice, EInputDeviceConnectionState::Disconnected);
+		GyroInputDevice = INPUTDEVICEID_NONE;
+	}
+	Super::EndPlay(EndPlayReason);
+}
+
+void ASWIPlayerController::SetupInputComponent()
+{
+	Super::SetupInputComponent();
+
+	if (!bBindGyroActions) return;
+
+	EnsureGyroInputAssets();
+	if (UEnhancedInputComponent* Input = Cast<UEnhancedInputComponent>(InputComponent))
+	{
+		Input->BindAction(GyroMoveAction, ETriggerEvent::Triggered, this, &ThisClass::HandleGyroMove);
+		Input->BindAction(GyroLookAction, ETriggerEvent::Triggered, this, &ThisClass::HandleGyroLook);
+	}
+	else
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[PC] InputComponent is not an EnhancedInputComponent; gyro actions are not bound"));
+	}
+}
+
+void ASWIPlayerController::EnsureGyroInputAssets()
+{
+	// 에셋 없이도 기본 동작하도록 런타임에 만든다
+	if (!GyroMoveAction)
+	{
+		GyroMoveAction = NewObject<UInputAction>(this, TEXT("IA_GyroMove"));
+		GyroMoveAction->ValueType = EInputActionValueType::Axis2D;
+	}
+	if (!GyroLookAction)
+	{
+		GyroLookAction = NewObject<UInputAction>(this, TEXT("IA_GyroLook"));
+		GyroLookAction->ValueType = EInputActionValueType::Axis2D;
+	}
+	if (!GyroMappingContext)
+	{
+		GyroMappingContext = NewObject<UInputMappingContext>(this, TEXT("IMC_Gyro"));
+		GyroMappingContext->MapKey(GyroMoveAction, FSWIGyroKeys::Move2D);
+		GyroMappingContext->MapKey(GyroLookAction, FSWIGyroKeys::Look2D);
+	}
+}
+
 void ASWIPlayerController::PlayerTick(float DeltaTime)
 {
+	// Injected before Super so this frame's input stack (mapping contexts, modifiers, triggers) evaluates it.
+	const bool bHasGyro = InjectGyroInput(DeltaTime);
+
 	Super::PlayerTick(DeltaTime);
 
-	APawn* P = GetPawn();
-	if (!P || !GyroReceiver)
+	if (bHasGyro)
 	{
-		return;
+		GyroReceiver->NotifyInputApplied();
+	}
+}
+
+void ASWIPlayerController::PostProcessInput(const float DeltaTime, const bool bGamePaused)
+{
+	// Presses recorded since last frame become at most one activation per ability, sent as one batched RPC.
+	if (USWIAbilitySystemComponent* ASC = Cast<USWIAbilitySystemComponent>(UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(GetPawn())))
+	{
+		ASC->ProcessAbilityInput();
+	}
+
+	Super::PostProcessInput(DeltaTime, bGamePaused);
+}
+
+bool ASWIPlayerController::InjectGyroInput(float DeltaTime)
+{
+	if (!GyroReceiver || !PlayerInput || !GetPawn())
+	{
+		return false;
 	}
 
 	FVector2D MoveAxis(0, 0), LookAxis(0, 0);
-	const bool bHasGyro = GyroReceiver->GetIAValues(MoveAxis, LookAxis);
+	const bool bHasGyro = GyroReceiver->ConsumeIAValues(DeltaTime, MoveAxis, LookAxis);
 
-	if (!bHasGyro)
+	// Rides in this frame's saved move, so a remote server starts walking on the move the axes produce.
+	if (USWICharacterMovementComponent* Move = Cast<USWICharacterMovementComponent>(GetPawn()->GetMovementComponent()))
 	{
-		return;
+		Move->SetGyroInput(bHasGyro);
 	}
 
-	if (ACharacter* C = Cast<ACharacter>(P))
+	if (!bHasGyro && !bGyroAxesLive)
 	{
-		if (UCharacterMovementComponent* M = C->GetCharacterMovement())
-		{
-			if (M->MovementMode == MOVE_None)
-			{
-				M->SetMovementMode(MOVE_Walking);
-			}
-		}
+		return false;
 	}
+	bGyroAxesLive = bHasGyro;
+
+	// Receiver convention is X = forward, Y = right; the keys use the stick's.
+	InjectGyroAxis(FSWIGyroKeys::MoveX, MoveAxis.Y, DeltaTime);
+	InjectGyroAxis(FSWIGyroKeys::MoveY, MoveAxis.X, DeltaTime);
+	InjectGyroAxis(FSWIGyroKeys::LookX, LookAxis.X, DeltaTime);
+	InjectGyroAxis(FSWIGyroKeys::LookY, LookAxis.Y, DeltaTime);
+	return bHasGyro;
+}
 
-	ApplyMoveAxis(P, MoveAxis);
-	ApplyLookAxis(LookAxis);
+void ASWIPlayerController::InjectGyroAxis(const FKey& Key, float Value, float DeltaTime)
+{
+	InputKey(FInputKeyEventArgs(nullptr, GyroInputDevice, Key, Value, DeltaTime, 1, FPlatformTime::Cycles64()));
 }
 
-void ASWIPlayerController::ApplyMoveAxis(APawn* ControlledPawn, const FVector2D& MoveAxis)
+void ASWIPlayerController::HandleGyroButtonPressed(int32 Button)
 {
-	const float Forward = MoveAxis.X * MoveScale;
-	const float Right = MoveAxis.Y * MoveScale;
+	// Edges go in as they arrive; the input stack counts a press and release within one frame as both.
+	if (Button == 0 && PlayerInput)
+	{
+		InputKey(FInputKeyEventArgs(nullptr, GyroInputDevice, FSWIGyroKeys::Fire, IE_Pressed));
+	}
 
-	if (FMath::IsNearlyZero(Forward) && FMath::IsNearlyZero(Right))
-		return;
+	if (Button == 0 && bFireActivatesAbilities)
+	{
+		if (USWIAbilitySystemComponent* ASC = Cast<USWIAbilitySystemComponent>(UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(GetPawn())))
+		{
+			ASC->AbilityInputTagPressed(SWIGameplayTags::Input_Gyro_Fire);
+		}
+	}
+}
 
-	FVector ForwardDir, RightDir;
+void ASWIPlayerController::HandleGyroButtonReleased(int32 Button, float HeldSec)
+{
+	if (Button == 0 && PlayerInput)
+	{
+		InputKey(FInputKeyEventArgs(nullptr, GyroInputDevice, FSWIGyroKeys::Fire, IE_Released));
+	}
 
-	if (bMoveByControlYaw)
+	if (Button == 0 && bFireActivatesAbilities)
 	{
-		const FRotator ControlRot = GetControlRotation();
-		const FRotator YawOnly(0.f, ControlRot.Yaw, 0.f);
-		ForwardDir = FRotationMatrix(YawOnly).GetUnitAxis(EAxis::X);
-		RightDir = FRotationMatrix(YawOnly).GetUnitAxis(EAxis::Y);
+		if (USWIAbilitySystemComponent* ASC = Cast<USWIAbilitySystemComponent>(UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(GetPawn())))
+		{
+			ASC->AbilityInputTagReleased(SWIGameplayTags::Input_Gyro_Fire);
+		}
 	}
-	else
+}
+
+void ASWIPlayerController::HandleGyroMove(const FInputActionValue& Value)
+{
+	APawn* P = GetPawn();
+	if (!P)
 	{
-		ForwardDir = ControlledPawn->GetActorForwardVector();
-		RightDir = ControlledPawn->GetActorRightVector();
+		return;
 	}
 
-	ControlledPawn->AddMovementInput(ForwardDir, Forward, /*bForce=*/true);
-	ControlledPawn->AddMovementInput(RightDir, Right,   /*bForce=*/true);
+	ApplyMoveAxis(P, Value.Get<FVector2D>());
+}
+
+void ASWIPlayerController::HandleGyroLook(const FInputActionValue& Value)
+{
+	ApplyLookAxis(Value.Get<FVector2D>());
+}
+
+void ASWIPlayerController::ApplyMoveAxis(APawn* ControlledPawn, const FVector2D& MoveAxis)
+{
+	SWIGyroPawnInput::ApplyMove(ControlledPawn, GetControlRotation(), MoveAxis, MoveScale, bMoveByControlYaw);
 }
 
 void ASWIPlayerController::ApplyLookAxis(const FVector2D& LookAxis)
@@ -5,6 +5,9 @@
 #include "SWIPlayerController.generated.h"
 
 class USWIGyroInputReceiverComponent;
+class UInputAction;
+class UInputMappingContext;
+struct FInputActionValue;
 
 UCLASS()
 class SWI_API ASWIPlayerController : public APlayerController
@@ -15,18 +18,67 @@ public:
 	ASWIPlayerController();
 
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void PlayerTick(float DeltaTime) override;
+	virtual void PostProcessInput(const float DeltaTime, const bool bGamePaused) override;
+
+	USWIGyroInputReceiverComponent* GetGyroReceiver() const { return GyroReceiver; }
 
 protected:
+	virtual void SetupInputComponent() override;
+
 	UPROPERTY(EditAnywhere, Category = "Gyro|Refs")
 	TObjectPtr<USWIGyroInputReceiverComponent> GyroReceiver = nullptr;
 
+	// Maps the FSWIGyroKeys. Empty = a runtime context mapping Move2D -> GyroMoveAction and Look2D -> GyroLookAction.
+	// Designers can instead map the gyro keys in their own contexts and clear bBindGyroActions.
+	UPROPERTY(EditAnywhere, Category = "Gyro|Input")
+	TObjectPtr<UInputMappingContext> GyroMappingContext = nullptr;
+
+	UPROPERTY(EditAnywhere, Category = "Gyro|Input")
+	int32 GyroMappingPriority = 0;
+
+	// Axis2D actions this controller applies to the pawn. Empty = created at runtime without modifiers.
+	UPROPERTY(EditAnywhere, Category = "Gyro|Input")
+	TObjectPtr<UInputAction> GyroMoveAction = nullptr;
+
+	UPROPERTY(EditAnywhere, Category = "Gyro|Input")
+	TObjectPtr<UInputAction> GyroLookAction = nullptr;
+
+	UPROPERTY(EditAnywhere, Category = "Gyro|Input")
+	bool bBindGyroActions = true;
+
+	// Fire also presses Input.Gyro.Fire on the pawn's ability system (USWIGameplayAbility_Fire and friends).
+	// Clear when a mapping context already activates the fire ability from the Fire key.
+	UPROPERTY(EditAnywhere, Category = "Gyro|Input")
+	bool bFireActivatesAbilities = true;
+
 	UPROPERTY(EditAnywhere, Category = "Gyro|Move")
 	float MoveScale = 1.0f;
 
 	UPROPERTY(EditAnywhere, Category = "Gyro|Move")
 	bool bMoveByControlYaw = true;
 
+	// Stick convention: X = right, Y = forward.
 	void ApplyMoveAxis(APawn* ControlledPawn, const FVector2D& MoveAxis);
 	void ApplyLookAxis(const FVector2D& LookAxis);
+
+private:
+	void EnsureGyroInputAssets();
+	bool InjectGyroInput(float DeltaTime);
+	void InjectGyroAxis(const FKey& Key, float Value, float DeltaTime);
+
+	void HandleGyroMove(const FInputActionValue& Value);
+	void HandleGyroLook(const FInputActionValue& Value);
+
+	UFUNCTION()
+	void HandleGyroButtonPressed(int32 Button);
+
+	UFUNCTION()
+	void HandleGyroButtonReleased(int32 Button, float HeldSec);
+
+	FInputDeviceId GyroInputDevice = INPUTDEVICEID_NONE;
+
+	// Axes were non-zero last frame; one zero frame is injected when the phone goes away.
+	bool bGyroAxesLive = false;
 };
@@ -0,0 +1,87 @@
+#include "SWIFireTraceSubsystem.h"
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "Engine/World.h"
+
+void USWIFireTraceSubsystem::QueueShot(FSWIFireShot&& Shot)
+{
+	++NumShots;
+
+	if (const int32* Index = PendingByShooter.Find(Shot.Shooter))
+	{
+		FTrace& Trace = Pending[*Index];
+		if (Trace.Channel == Shot.Channel && Trace.Source == Shot.Source
+			&& Trace.Start.Equals(Shot.Start, CoalesceToleranceCm) && Trace.End.Equals(Shot.End, CoalesceToleranceCm))
+		{
+			Trace.Damage.Add(MoveTemp(Shot.Damage));
+			return;
+		}
+	}
+
+	FTrace& Trace = Pending.AddDefaulted_GetRef();
+	Trace.Shooter = Shot.Shooter;
+	Trace.Source = Shot.Source;
+	Trace.Damage.Add(MoveTemp(Shot.Damage));
+	Trace.Start = Shot.Start;
+	Trace.End = Shot.End;
+	Trace.Channel = Shot.Channel;
+	PendingByShooter.Add(Shot.Shooter, Pending.Num() - 1);
+}
+
+void USWIFireTraceSubsystem::Tick(float DeltaTime)
+{
+	if (Pending.Num() == 0) return;
+
+	UWorld* World = GetWorld();
+	if (!World) return;
+
+	if (!TraceDelegate.IsBound())
+	{
+		TraceDelegate.BindUObject(this, &ThisClass::HandleTraceDone);
+	}
+
+	for (FTrace& Trace : Pending)
+	{
+		FCollisionQueryParams Params(SCENE_QUERY_STAT(SWIFireTrace), false, Trace.Shooter.Get());
+
+		const uint32 Id = NextTraceId++;
+		World->AsyncLineTraceByChannel(EAsyncTraceType::Single, Trace.Start, Trace.End, Trace.Channel, Params,
+			FCollisionResponseParams::DefaultResponseParam, &TraceDelegate, Id);
+		InFlight.Add(Id, MoveTemp(Trace));
+		++NumTraces;
+	}
+
+	Pending.Reset();
+	PendingByShooter.Reset();
+}
+
+void USWIFireTraceSubsystem::HandleTraceDone(const FTraceHandle& Handle, FTraceDatum& Datum)
+{
+	FTrace Trace;
+	if (!InFlight.RemoveAndCopyValue(Datum.UserData, Trace)) return;
+
+	UAbilitySystemComponent* Source = Trace.Source.Get();
+	AActor* HitActor = Datum.OutHits.Num() > 0 ? Datum.OutHits[0].GetActor() : nullptr;
+	if (!Source || !HitActor) return;
+
+	UAbilitySystemComponent* Target = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(HitActor);
+	if (!Target) return;
+
+	for (const FGameplayEffectSpecHandle& Damage : Trace.Damage)
+	{
+		if (Damage.IsValid())
+		{
+			Source->ApplyGameplayEffectSpecToTarget(*Damage.Data.Get(), Target);
+		}
+	}
+}
+
+TStatId USWIFireTraceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USWIFireTraceSubsystem, STATGROUP_Tickables);
+}
+
+bool USWIFireTraceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
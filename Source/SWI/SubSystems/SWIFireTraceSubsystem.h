@@ -0,0 +1,69 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GameplayEffectTypes.h"
+#include "WorldCollision.h"
+#include "SWIFireTraceSubsystem.generated.h"
+
+class UAbilitySystemComponent;
+
+struct FSWIFireShot
+{
+	TWeakObjectPtr<AActor> Shooter;
+	TWeakObjectPtr<UAbilitySystemComponent> Source;
+	FGameplayEffectSpecHandle Damage;		// applied to the hit actor's ability system; may be empty
+	FVector Start = FVector::ZeroVector;
+	FVector End = FVector::ZeroVector;
+	ECollisionChannel Channel = ECC_Visibility;
+};
+
+/**
+ * Server hit detection for gyro fire, as async traces collected per frame.
+ *
+ * Shots queue during the frame and are issued together at the end of it, so the traces run off the game thread in
+ * the next frame's async trace batch. A client's activations arrive in bursts (one per net update), so shots from one
+ * shooter along the same ray in a frame share a trace and each applies its damage to the hit. Game thread.
+ */
+UCLASS()
+class SWI_API USWIFireTraceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	void QueueShot(FSWIFireShot&& Shot);
+
+	// Rays closer than this (cm, both ends) from the same shooter in one frame share a trace.
+	float CoalesceToleranceCm = 1.f;
+
+	int64 GetNumShots() const { return NumShots; }
+	int64 GetNumTraces() const { return NumTraces; }
+
+	// UTickableWorldSubsystem
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	// ~UTickableWorldSubsystem
+
+private:
+	struct FTrace
+	{
+		TWeakObjectPtr<AActor> Shooter;
+		TWeakObjectPtr<UAbilitySystemComponent> Source;
+		TArray<FGameplayEffectSpecHandle, TInlineAllocator<1>> Damage;
+		FVector Start = FVector::ZeroVector;
+		FVector End = FVector::ZeroVector;
+		ECollisionChannel Channel = ECC_Visibility;
+	};
+
+	void HandleTraceDone(const FTraceHandle& Handle, FTraceDatum& Datum);
+
+	TArray<FTrace> Pending;
+	TMap<TWeakObjectPtr<AActor>, int32> PendingByShooter;		// newest pending trace per shooter
+	TMap<uint32, FTrace> InFlight;		// by trace UserData
+	uint32 NextTraceId = 1;
+	FTraceDelegate TraceDelegate;
+
+	int64 NumShots = 0;
+	int64 NumTraces = 0;
+};
@@ -0,0 +1,496 @@
+#include "SWIHubServerSubsystem.h"
+#include "SWIHubServiceSubsystem.h"
+#include "SWI/Hub/SWIHubImuDecoder.h"
+#include "SWI/Hub/SWIHubLatencyStats.h"
+#include "Dom/JsonObject.h"
+#include "IWebSocketNetworkingModule.h"
+#include "IWebSocketServer.h"
+#include "INetworkingWebSocket.h"
+#include "WebSocketNetworkingDelegates.h"
+#include "HAL/FileManager.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+void USWIHubServerSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	Hub = Collection.InitializeDependency<USWIHubClientSubsystem>();
+
+	if (bAutoStartServer)
+	{
+		StartServer();
+	}
+}
+
+void USWIHubServerSubsystem::Deinitialize()
+{
+	StopServer();
+	Hub = nullptr;
+
+	Super::Deinitialize();
+}
+
+void USWIHubServerSubsystem::Tick(float DeltaTime)
+{
+	// Services the sockets; every callback below runs from here, on the game thread.
+	Server->Tick();
+}
+
+ETickableTickType USWIHubServerSubsystem::GetTickableTickType() const
+{
+	return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool USWIHubServerSubsystem::IsTickable() const
+{
+	return Server.IsValid();
+}
+
+TStatId USWIHubServerSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USWIHubServerSubsystem, STATGROUP_Tickables);
+}
+
+bool USWIHubServerSubsystem::StartServer()
+{
+	if (Server.IsValid()) return true;
+	if (!Hub)
+	{
+		UE_LOG(LogTemp, Error, TEXT("[HUB] Server: client subsystem missing"));
+		return false;
+	}
+
+	Server = FModuleManager::LoadModuleChecked<IWebSocketNetworkingModule>(TEXT("WebSocketNetworking")).CreateServer();
+
+	if (bServeSensorPage)
+	{
+		const FString PageDir = StageSensorPage();
+		if (!PageDir.IsEmpty())
+		{
+			FWebSocketHttpMount Mount;
+			Mount.SetWebPath(TEXT("/"));
+			Mount.SetPathOnDisk(PageDir);
+			Mount.SetDefaultFile(TEXT("sensor.html"));
+			Server->EnableHTTPServer({ Mount });
+		}
+	}
+
+	FWebSocketClientConnectedCallBack OnConnected;
+	OnConnected.BindUObject(this, &ThisClass::HandleClientConnected);
+
+	if (!Server->Init(static_cast<uint32>(Port), OnConnected, BindAddress))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[HUB] Server: failed to listen on %s:%d"), BindAddress.IsEmpty() ? TEXT("*") : *BindAddress, Port);
+		Server.Reset();
+		return false;
+	}
+
+	Hub->SetLocalSourceActive(true);
+	UE_LOG(LogTemp, Log, TEXT("[HUB] Server: listening on %s:%d (phones: ws://<this-host>:%d/ws)"),
+		BindAddress.IsEmpty() ? TEXT("*") : *BindAddress, Port, Port);
+	return true;
+}
+
+void USWIHubServerSubsystem::StopServer()
+{
+	if (!Server.IsValid()) return;
+
+	// Tell the local pipeline the phones are gone; the sockets die with the server.
+	TArray<INetworkingWebSocket*> Sockets;
+	Connections.GetKeys(Sockets);
+	for (INetworkingWebSocket* Socket : Sockets)
+	{
+		HandleClosed(Socket);
+	}
+
+	Server.Reset();
+	WaitingQueue.Reset();
+	Matches.Reset();
+
+	if (Hub)
+	{
+		Hub->SetLocalSourceActive(false);
+	}
+	UE_LOG(LogTemp, Log, TEXT("[HUB] Server: stopped"));
+}
+
+FString USWIHubServerSubsystem::StageSensorPage()
+{
+	// The mount serves every file under its directory, so it gets one holding nothing but the page.
+	const FString Source = FPaths::Combine(FPaths::ProjectDir(), TEXT("Sockets"), TEXT("sensor.html"));
+	const FString Dir = FPaths::ConvertRelativePathToFull(FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("HubSensorPage")));
+
+	IFileManager& FileManager = IFileManager::Get();
+	FileManager.DeleteDirectory(*Dir, false, true);
+	if (FileManager.Copy(*FPaths::Combine(Dir, TEXT("sensor.html")), *Source) != COPY_OK)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[HUB] Server: could not stage %s; sensor page disabled"), *Source);
+		return FString();
+	}
+	return Dir;
+}
+
+void USWIHubServerSubsystem::HandleClientConnected(INetworkingWebSocket* Socket)
+{
+	FPhoneConnection& Conn = Connections.Add(Socket);
+	Conn.Remote = Socket->RemoteEndPoint(true);
+
+	FWebSocketPacketReceivedCallBack OnPacket;
+	OnPacket.BindUObject(this, &ThisClass::HandlePacket, Socket);
+	Socket->SetReceiveCallBack(OnPacket);
+
+	FWebSocketInfoCallBack OnClosed;
+	OnClosed.BindUObject(this, &ThisClass::HandleClosed, Socket);
+	Socket->SetSocketClosedCallBack(OnClosed);
+
+	FWebSocketInfoCallBack OnError;
+	OnError.BindUObject(this, &ThisClass::HandleClosed, Socket);
+	Socket->SetErrorCallBack(OnError);
+
+	// The query string (uid/name) is not visible here; the phone's hello carries the same identity.
+	const TSharedRef<FJsonObject> Msg = MakeShared<FJsonObject>();
+	Msg->SetStringField(TEXT("type"), TEXT("server_hello"));
+	Msg->SetNumberField(TEXT("server_ts"), ServerTs());
+	Msg->SetStringField(TEXT("role"), TEXT("phone"));
+	Send(Socket, ToJson(Msg));
+
+	UE_LOG(LogTemp, Log, TEXT("[HUB] Server: connected remote=%s clients=%d"), *Conn.Remote, Connections.Num());
+}
+
+void USWIHubServerSubsystem::HandlePacket(void* Data, int32 Size, INetworkingWebSocket* Socket)
+{
+	FPhoneConnection* Conn = Connections.Find(Socket);
+	if (!Conn || Size <= 0) return;
+
+	const double RecvTimeSec = FPlatformTime::Seconds();
+	const uint8* Bytes = static_cast<const uint8*>(Data);
+
+	// Text and binary frames arrive through the same callback; bin1 starts with its magic byte, JSON with '{'.
+	if (Bytes[0] == SWIHubImuWire::Magic)
+	{
+		uint16 UnusedIndex = 0;
+		FSWIHubImuFrame Frame;
+		if (!Conn->Uid.IsEmpty() && SWIHubImuDecoder::DecodeBinary(TConstArrayView<uint8>(Bytes, Size), UnusedIndex, Frame))
+		{
+			Frame.RecvTimeSec = RecvTimeSec;
+			HandleImu(*Conn, MoveTemp(Frame));
+		}
+		return;
+	}
+
+	const FUTF8ToTCHAR Text(reinterpret_cast<const ANSICHAR*>(Bytes), Size);
+	const FStringView Raw(Text.Get(), Text.Length());
+
+	FSWIHubImuFrame Frame;
+	if (SWIHubImuDecoder::Decode(Raw, Frame, ScratchIdentity) == ESWIHubDecodeResult::Imu)
+	{
+		if (Conn->Uid.IsEmpty() && !ScratchIdentity.Uid.IsEmpty())
+		{
+			// No hello yet: adopt the uid the phone stamps on its frames.
+			Conn->Uid = ScratchIdentity.Uid;
+			Conn->Name = ScratchIdentity.Name;
+			Announce(Socket, *Conn);
+		}
+		if (!Conn->Uid.IsEmpty())
+		{
+			Frame.RecvTimeSec = RecvTimeSec;
+			HandleImu(*Conn, MoveTemp(Frame));
+		}
+		return;
+	}
+
+	TSharedPtr<FJsonObject> Root;
+	if (FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(FString(Raw)), Root) && Root.IsValid())
+	{
+		HandleJson(Socket, *Conn, Root, Raw);
+	}
+}
+
+void USWIHubServerSubsystem::HandleImu(FPhoneConnection& Conn, FSWIHubImuFrame&& Frame)
+{
+	// The connection owns the identity, as in the hub.
+	Frame.Device = Hub->GetDeviceHandles().Intern(Conn.Uid, Conn.Name, Conn.MatchId);
+
+	// Received and forwarded in the same call: there is no relay dwell.
+	Frame.HubRxMs = FSWIHubLatencyTracker::ToUnixMs(Frame.RecvTimeSec);
+	Frame.HubTxMs = Frame.HubRxMs;
+
+	Hub->InjectImuFrame(MoveTemp(Frame));
+}
+
+void USWIHubServerSubsystem::HandleJson(INetworkingWebSocket* Socket, FPhoneConnection& Conn, const TSharedPtr<FJsonObject>& Root, FStringView Raw)
+{
+	FString Type;
+	Root->TryGetStringField(TEXT("type"), Type);
+
+	FString Uid, Name;
+	if (Root->TryGetStringField(TEXT("uid"), Uid) && !Uid.IsEmpty() && Uid != Conn.Uid)
+	{
+		// As in the hub: the old uid leaves before the new one is announced, unless a newer connection owns it.
+		if (SocketByUid.FindRef(Conn.Uid) == Socket)
+		{
+			SocketByUid.Remove(Conn.Uid);
+			if (Conn.bAnnounced)
+			{
+				PublishDevice(TEXT("device_disconnected"), Conn);
+			}
+		}
+		Conn.Uid = Uid.Left(64);
+		Conn.bAnnounced = false;
+	}
+	if (Root->TryGetStringField(TEXT("name"), Name))
+	{
+		Conn.Name = Name.Left(64);
+	}
+	if (Conn.Uid.IsEmpty())
+	{
+		// Same fallback as the hub for a phone that never names itself.
+		Conn.Uid = FGuid::NewGuid().ToString(EGuidFormats::DigitsWithHyphensLower);
+	}
+	Announce(Socket, Conn);
+
+	if (Type == TEXT("hello"))
+	{
+		const TSharedRef<FJsonObject> Ack = MakeShared<FJsonObject>();
+		Ack->SetStringField(TEXT("type"), TEXT("hello_ack"));
+		Ack->SetNumberField(TEXT("server_ts"), ServerTs());
+		Ack->SetStringField(TEXT("uid"), Conn.Uid);
+		Ack->SetStringField(TEXT("imu_format"), TEXT("json"));
+		Send(Socket, ToJson(Ack));
+		return;
+	}
+
+	if (Type == TEXT("join_request"))
+	{
+		if (!Conn.MatchId.IsEmpty())
+		{
+			Send(Socket, FString::Printf(TEXT("{\"type\":\"already_in_match\",\"match_id\":\"%s\"}"), *Conn.MatchId));
+			return;
+		}
+
+		WaitingQueue.AddUnique(Conn.Uid);
+
+		const TSharedRef<FJsonObject> Status = MakeShared<FJsonObject>();
+		Status->SetStringField(TEXT("type"), TEXT("queue_status"));
+		Status->SetNumberField(TEXT("server_ts"), ServerTs());
+		Status->SetBoolField(TEXT("queued"), true);
+		Status->SetNumberField(TEXT("queue_len"), WaitingQueue.Num());
+		Send(Socket, ToJson(Status));
+
+		TryStartMatches();
+		return;
+	}
+
+	if (Type == TEXT("leave_queue") || Type == TEXT("leave"))
+	{
+		WaitingQueue.Remove(Conn.Uid);
+		if (!Conn.MatchId.IsEmpty())
+		{
+			AbortMatch(Conn.MatchId, FString::Printf(TEXT("leave:%s"), *Conn.Uid));
+		}
+		Send(Socket, FString::Printf(TEXT("{\"type\":\"left\",\"server_ts\":%.3f}"), ServerTs()));
+		return;
+	}
+
+	if (Type == TEXT("chat"))
+	{
+		if (const FMatch* Match = Matches.Find(Conn.MatchId))
+		{
+			const FString Text(Raw);
+			SendToUid(Match->Uids[0], Text);
+			SendToUid(Match->Uids[1], Text);
+			PublishLocal(Text);
+		}
+		return;
+	}
+
+	// Default relay: anything else from a phone reaches UE as "relay", like the hub.
+	Root->SetStringField(TEXT("type"), TEXT("relay"));
+	PublishLocal(ToJson(Root.ToSharedRef()));
+}
+
+void USWIHubServerSubsystem::Announce(INetworkingWebSocket* Socket, FPhoneConnection& Conn)
+{
+	if (Conn.bAnnounced || Conn.Uid.IsEmpty()) return;
+	Conn.bAnnounced = true;
+	SocketByUid.Add(Conn.Uid, Socket);
+
+	PublishDevice(TEXT("device_connected"), Conn);
+
+	UE_LOG(LogTemp, Log, TEXT("[HUB] Server: phone uid=%s name=%s remote=%s"), *Conn.Uid, *Conn.Name, *Conn.Remote);
+}
+
+void USWIHubServerSubsystem::PublishDevice(const TCHAR* Type, const FPhoneConnection& Conn)
+{
+	const TSharedRef<FJsonObject> Msg = MakeShared<FJsonObject>();
+	Msg->SetStringField(TEXT("type"), Type);
+	Msg->SetNumberField(TEXT("server_ts"), ServerTs());
+	Msg->SetStringField(TEXT("uid"), Conn.Uid);
+	Msg->SetStringField(TEXT("name"), Conn.Name);
+	Msg->SetStringField(TEXT("role"), TEXT("phone"));
+	Msg->SetStringField(TEXT("remote"), Conn.Remote);
+	PublishLocal(ToJson(Msg));
+}
+
+void USWIHubServerSubsystem::HandleClosed(INetworkingWebSocket* Socket)
+{
+	FPhoneConnection Conn;
+	if (!Connections.RemoveAndCopyValue(Socket, Conn)) return;
+
+	WaitingQueue.Remove(Conn.Uid);
+	if (SocketByUid.FindRef(Conn.Uid) == Socket)
+	{
+		SocketByUid.Remove(Conn.Uid);
+	}
+
+	if (!Conn.MatchId.IsEmpty())
+	{
+		AbortMatch(Conn.MatchId, FString::Printf(TEXT("disconnect:%s"), *Conn.Uid));
+	}
+
+	if (Conn.bAnnounced)
+	{
+		PublishDevice(TEXT("device_disconnected"), Conn);
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("[HUB] Server: disconnected uid=%s remote=%s clients=%d"), *Conn.Uid, *Conn.Remote, Connections.Num());
+}
+
+void USWIHubServerSubsystem::TryStartMatches()
+{
+	while (WaitingQueue.Num() >= 2)
+	{
+		const FString Uid1 = WaitingQueue[0];
+		const FString Uid2 = WaitingQueue[1];
+		WaitingQueue.RemoveAt(0, 2);
+
+		FPhoneConnection* C1 = Connections.Find(SocketByUid.FindRef(Uid1));
+		FPhoneConnection* C2 = Connections.Find(SocketByUid.FindRef(Uid2));
+		if (!C1 || !C2) continue;
+
+		const FString MatchId = FString::Printf(TEXT("m%lld_%s"),
+			static_cast<int64>(FSWIHubLatencyTracker::ToUnixMs(FPlatformTime::Seconds())),
+			*FGuid::NewGuid().ToString(EGuidFormats::Digits).Left(6).ToLower());
+
+		FMatch& Match = Matches.Add(MatchId);
+		Match.Uids[0] = C1->Uid;
+		Match.Uids[1] = C2->Uid;
+		Match.Names[0] = C1->Name;
+		Match.Names[1] = C2->Name;
+		C1->MatchId = MatchId;
+		C2->MatchId = MatchId;
+
+		TArray<TSharedPtr<FJsonValue>> Players;
+		for (int32 i = 0; i < 2; ++i)
+		{
+			const TSharedRef<FJsonObject> P = MakeShared<FJsonObject>();
+			P->SetStringField(TEXT("uid"), Match.Uids[i]);
+			P->SetStringField(TEXT("name"), Match.Names[i]);
+			Players.Add(MakeShared<FJsonValueObject>(P));
+		}
+
+		const TSharedRef<FJsonObject> Msg = MakeShared<FJsonObject>();
+		Msg->SetStringField(TEXT("type"), TEXT("match_start"));
+		Msg->SetNumberField(TEXT("server_ts"), ServerTs());
+		Msg->SetStringField(TEXT("match_id"), MatchId);
+		Msg->SetArrayField(TEXT("players"), Players);
+
+		const FString Json = ToJson(Msg);
+		SendToUid(Match.Uids[0], Json);
+		SendToUid(Match.Uids[1], Json);
+		PublishLocal(Json);
+
+		UE_LOG(LogTemp, Log, TEXT("[HUB] Server: match start %s (%s,%s)"), *MatchId, *Match.Uids[0], *Match.Uids[1]);
+	}
+}
+
+void USWIHubServerSubsystem::AbortMatch(const FString& MatchId, const FString& Reason)
+{
+	const TSharedRef<FJsonObject> Msg = MakeShared<FJsonObject>();
+	Msg->SetStringField(TEXT("type"), TEXT("match_abort"));
+	Msg->SetNumberField(TEXT("server_ts"), ServerTs());
+	Msg->SetStringField(TEXT("match_id"), MatchId);
+	Msg->SetStringField(TEXT("reason"), Reason);
+	EndMatch(MatchId, Msg);
+}
+
+void USWIHubServerSubsystem::ReportMatchResult(const FString& MatchId, const FString& WinnerUid)
+{
+	if (!Matches.Contains(MatchId))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[HUB] Server: match_result for unknown match %s"), *MatchId);
+		return;
+	}
+
+	const TSharedRef<FJsonObject> Result = MakeShared<FJsonObject>();
+	Result->SetStringField(TEXT("type"), TEXT("match_result"));
+	Result->SetStringField(TEXT("match_id"), MatchId);
+	Result->SetStringField(TEXT("winner_uid"), WinnerUid);
+
+	const TSharedRef<FJsonObject> Msg = MakeShared<FJsonObject>();
+	Msg->SetStringField(TEXT("type"), TEXT("match_end"));
+	Msg->SetNumberField(TEXT("server_ts"), ServerTs());
+	Msg->SetStringField(TEXT("match_id"), MatchId);
+	Msg->SetStringField(TEXT("winner_uid"), WinnerUid);
+	Msg->SetObjectField(TEXT("result"), Result);
+	EndMatch(MatchId, Msg);
+
+	UE_LOG(LogTemp, Log, TEXT("[HUB] Server: match end %s winner=%s"), *MatchId, *WinnerUid);
+}
+
+void USWIHubServerSubsystem::EndMatch(const FString& MatchId, const TSharedRef<FJsonObject>& Payload)
+{
+	FMatch Match;
+	if (!Matches.RemoveAndCopyValue(MatchId, Match)) return;
+
+	const FString Json = ToJson(Payload);
+	for (const FString& Uid : Match.Uids)
+	{
+		if (FPhoneConnection* Conn = Connections.Find(SocketByUid.FindRef(Uid)))
+		{
+			Conn->MatchId.Reset();
+		}
+		SendToUid(Uid, Json);
+	}
+	PublishLocal(Json);
+}
+
+void USWIHubServerSubsystem::Send(INetworkingWebSocket* Socket, const FString& Json)
+{
+	// Phones only log server messages, so they are sent as-is (binary frames carrying UTF-8 JSON).
+	const FTCHARToUTF8 Utf8(*Json);
+	Socket->Send(reinterpret_cast<const uint8*>(Utf8.Get()), static_cast<uint32>(Utf8.Length()), /*bPrependSize=*/false);
+}
+
+void USWIHubServerSubsystem::SendToUid(const FString& Uid, const FString& Json)
+{
+	if (INetworkingWebSocket* Socket = SocketByUid.FindRef(Uid))
+	{
+		Send(Socket, Json);
+	}
+}
+
+void USWIHubServerSubsystem::PublishLocal(const FString& Json)
+{
+	Hub->InjectControlMessage(Json);
+}
+
+double USWIHubServerSubsystem::ServerTs()
+{
+	return FSWIHubLatencyTracker::ToUnixMs(FPlatformTime::Seconds()) * 0.001;
+}
+
+FString USWIHubServerSubsystem::ToJson(const TSharedRef<FJsonObject>& Obj)
+{
+	FString Out;
+	const TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+		TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Out);
+	FJsonSerializer::Serialize(Obj, Writer);
+	return Out;
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
+#include "SWI/SWIHubProtocolTypes.h"
+#include "SWI/Hub/SWIHubDeviceHandles.h"
+#include "SWIHubServerSubsystem.generated.h"
+
+class FJsonObject;
+class IWebSocketServer;
+class INetworkingWebSocket;
+class USWIHubClientSubsystem;
+
+/**
+ * Optional in-engine replacement for Sockets/imu_hub.py: phones connect straight to UE.
+ *
+ * Speaks the phone side of the hub protocol (hello, imu JSON / bin1, join_request, leave, chat, match flow) and feeds
+ * the result into USWIHubClientSubsystem exactly as if it had come from the hub socket, so routing, device state,
+ * OnImuFrame and OnDeviceConnected behave the same. No per-packet logging, re-encoding or relay hop.
+ */
+UCLASS()
+class SWI_API USWIHubServerSubsystem : public UGameInstanceSubsystem, public FTickableGameObject
+{
+	GENERATED_BODY()
+
+public:
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+	virtual void Deinitialize() override;
+
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual bool IsTickable() const override;
+	virtual bool IsTickableWhenPaused() const override { return true; }
+	virtual TStatId GetStatId() const override;
+	// ~FTickableGameObject
+
+	UFUNCTION(BlueprintCallable, Category = "HUB|Server")
+	bool StartServer();
+
+	UFUNCTION(BlueprintCallable, Category = "HUB|Server")
+	void StopServer();
+
+	UFUNCTION(BlueprintPure, Category = "HUB|Server")
+	bool IsServerRunning() const { return Server.IsValid(); }
+
+	UFUNCTION(BlueprintPure, Category = "HUB|Server")
+	int32 GetNumPhones() const { return SocketByUid.Num(); }
+
+	// Same as the hub's match_result from UE: ends the match on the phones and locally.
+	UFUNCTION(BlueprintCallable, Category = "HUB|Server")
+	void ReportMatchResult(const FString& MatchId, const FString& WinnerUid);
+
+private:
+	struct FPhoneConnection
+	{
+		FString Uid;
+		FString Name;
+		FString Remote;
+		FString MatchId;
+		bool bAnnounced = false;
+	};
+
+	struct FMatch
+	{
+		FString Uids[2];
+		FString Names[2];
+	};
+
+	void HandleClientConnected(INetworkingWebSocket* Socket);
+	void HandlePacket(void* Data, int32 Size, INetworkingWebSocket* Socket);
+	void HandleClosed(INetworkingWebSocket* Socket);
+
+	void HandleImu(FPhoneConnection& Conn, FSWIHubImuFrame&& Frame);
+	void HandleJson(INetworkingWebSocket* Socket, FPhoneConnection& Conn, const TSharedPtr<FJsonObject>& Root, FStringView Raw);
+	void Announce(INetworkingWebSocket* Socket, FPhoneConnection& Conn);
+	void PublishDevice(const TCHAR* Type, const FPhoneConnection& Conn);
+
+	// Copies Sockets/sensor.html alone into Saved/HubSensorPage and returns that directory; empty on failure.
+	static FString StageSensorPage();
+
+	void TryStartMatches();
+	void AbortMatch(const FString& MatchId, const FString& Reason);
+	void EndMatch(const FString& MatchId, const TSharedRef<FJsonObject>& Payload);
+
+	void Send(INetworkingWebSocket* Socket, const FString& Json);
+	void SendToUid(const FString& Uid, const FString& Json);
+	void PublishLocal(const FString& Json);
+
+	static double ServerTs();
+	static FString ToJson(const TSharedRef<FJsonObject>& Obj);
+
+	UPROPERTY(EditAnywhere, Category = "HUB|Server")
+	bool bAutoStartServer = false;
+
+	// The Python hub defaults to 8080; a different port lets both run side by side.
+	UPROPERTY(EditAnywhere, Category = "HUB|Server")
+	int32 Port = 8081;
+
+	// Empty = all interfaces.
+	UPROPERTY(EditAnywhere, Category = "HUB|Server")
+	FString BindAddress;
+
+	// Serve Sockets/sensor.html on the same port so phones only need the UE machine's address.
+	// Only that page is served (from a staged copy), never the rest of Sockets/ (hub script, logs, db).
+	UPROPERTY(EditAnywhere, Category = "HUB|Server")
+	bool bServeSensorPage = true;
+
+	UPROPERTY()
+	TObjectPtr<USWIHubClientSubsystem> Hub = nullptr;
+
+	TUniquePtr<IWebSocketServer> Server;
+
+	TMap<INetworkingWebSocket*, FPhoneConnection> Connections;
+	TMap<FString, INetworkingWebSocket*> SocketByUid;
+	TArray<FString> WaitingQueue;
+	TMap<FString, FMatch> Matches;
+
+	// Identity decoded from JSON frames; reused so steady-state decoding does not allocate. Game thread.
+	FSWIHubDeviceIdentity ScratchIdentity;
+};
@@ -1,5 +1,6 @@
 #include "SWIHubServiceSubsystem.h"
-#include "Async/Async.h"
+#include "SWI/Hub/SWIHubImuDecoder.h"
+#include "SWI/Components/SWIGyroInputReceiverComponent.h"
 #include "Dom/JsonObject.h"
 #include "GenericPlatform/GenericPlatformHttp.h"
 #include "HttpModule.h"
@@ -11,6 +12,10 @@
 #include "TimerManager.h"
 #include "WebSocketsModule.h"
 #include "Engine/World.h"
+#include "Engine/GameInstance.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 static FString TrimSlashEnd(const FString& In)
 {
@@ -22,18 +27,6 @@ static FString TrimSlashEnd(const FString& In)
 	return S;
 }
 
-bool USWIHubClientSubsystem::TryGetNumberAsFloat(const TSharedPtr<FJsonObject>& Root, const TCHAR* Key, float& Out)
-{
-	double D = 0.0;
-	if (!Root.IsValid()) return false;
-	if (Root->TryGetNumberField(Key, D))
-	{
-		Out = static_cast<float>(D);
-		return true;
-	}
-	return false;
-}
-
 bool USWIHubClientSubsystem::TryParseDeviceInfo(const TSharedPtr<FJsonObject>& Root, FSWIHubDeviceInfo& Out) const
 {
 	if (!Root.IsValid()) return false;
@@ -46,37 +39,54 @@ bool USWIHubClientSubsystem::TryParseDeviceInfo(const TSharedPtr<FJsonObject>& R
 	return !Out.Uid.IsEmpty() || !Out.Role.IsEmpty();
 }
 
-bool USWIHubClientSubsystem::TryParseImuFrame(const TSharedPtr<FJsonObject>& Root, FSWIHubImuFrame& Out) const
+void USWIHubClientSubsystem::ParseDeviceArray(const TSharedPtr<FJsonObject>& Root, const TCHAR* Field, TArray<FSWIHubDeviceInfo>& Out) const
 {
-	if (!Root.IsValid()) return false;
+	const TArray<TSharedPtr<FJsonValue>>* Arr = nullptr;
+	if (!Root.IsValid() || !Root->TryGetArrayField(Field, Arr) || !Arr) return;
 
-	Root->TryGetStringField(TEXT("match_id"), Out.MatchId);
-	Root->TryGetStringField(TEXT("matchId"), Out.MatchId);
-	Root->TryGetStringField(TEXT("uid"), Out.Uid);
-	Root->TryGetStringField(TEXT("name"), Out.Name);
+	Out.Reserve(Arr->Num());
+	for (const TSharedPtr<FJsonValue>& V : *Arr)
+	{
+		const TSharedPtr<FJsonObject>* O = nullptr;
+		if (!V.IsValid() || !V->TryGetObject(O) || !O || !O->IsValid()) continue;
 
-	double Ts = 0.0;
-	if (Root->TryGetNumberField(TEXT("ts_ms"), Ts)) Out.TsMs = Ts;
-	if (Root->TryGetNumberField(TEXT("tsMs"), Ts))  Out.TsMs = Ts;
-	if (Root->TryGetNumberField(TEXT("ts"), Ts))    Out.TsMs = Ts;
+		FSWIHubDeviceInfo D;
+		if (TryParseDeviceInfo(*O, D) && !D.Uid.IsEmpty())
+		{
+			// device_list only carries phones and may omit the role
+			if (D.Role.IsEmpty()) D.Role = TEXT("phone");
+			Out.Add(MoveTemp(D));
+		}
+	}
+}
 
-	TryGetNumberAsFloat(Root, TEXT("yaw"), Out.Yaw);
-	TryGetNumberAsFloat(Root, TEXT("pitch"), Out.Pitch);
-	TryGetNumberAsFloat(Root, TEXT("roll"), Out.Roll);
+bool USWIHubClientSubsystem::TryParseImuFrame(const TSharedPtr<FJsonObject>& Root, FSWIHubImuFrame& Out, FSWIHubDeviceIdentity& OutIdentity) const
+{
+	return SWIHubImuDecoder::DecodeFromJsonObject(Root, Out, OutIdentity);
+}
+
+bool USWIHubClientSubsystem::TryParseMatchStart(const TSharedPtr<FJsonObject>& Root, FHubMatchStart& Out) const
+{
+	if (!Root.IsValid()) return false;
 
-	TryGetNumberAsFloat(Root, TEXT("ax"), Out.Ax);
-	TryGetNumberAsFloat(Root, TEXT("ay"), Out.Ay);
-	TryGetNumberAsFloat(Root, TEXT("az"), Out.Az);
+	Root->TryGetNumberField(TEXT("server_ts"), Out.ServerTs);
+	Root->TryGetStringField(TEXT("match_id"), Out.MatchId);
 
-	TryGetNumberAsFloat(Root, TEXT("gx"), Out.Gx);
-	TryGetNumberAsFloat(Root, TEXT("gy"), Out.Gy);
-	TryGetNumberAsFloat(Root, TEXT("gz"), Out.Gz);
+	const TArray<TSharedPtr<FJsonValue>>* PlayersArr = nullptr;
+	if (Root->TryGetArrayField(TEXT("players"), PlayersArr) && PlayersArr)
+	{
+		for (const TSharedPtr<FJsonValue>& V : *PlayersArr)
+		{
+			const TSharedPtr<FJsonObject>* O = nullptr;
+			if (!V.IsValid() || !V->TryGetObject(O) || !O || !O->IsValid()) continue;
 
-	int32 Fire = 0;
-	Root->TryGetNumberField(TEXT("fire"), Fire);
-	Out.Fire = Fire;
+			FHubPlayerInfo& P = Out.Players.AddDefaulted_GetRef();
+			(*O)->TryGetStringField(TEXT("uid"), P.Uid);
+			(*O)->TryGetStringField(TEXT("name"), P.Name);
+		}
+	}
 
-	return !Out.Uid.IsEmpty();
+	return !Out.MatchId.IsEmpty();
 }
 
 void USWIHubClientSubsystem::Initialize(FSubsystemCollectionBase& Collection)
@@ -85,6 +95,8 @@ void USWIHubClientSubsystem::Initialize(FSubsystemCollectionBase& Collection)
 
 	UE_LOG(LogTemp, Log, TEXT("[HUB] Subsystem Initialize"));
 
+	ImuQueue.Reset(static_cast<uint32>(ImuQueueCapacity));
+
 	PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(
 		this, &ThisClass::HandlePostLoadMap
 	);
@@ -100,6 +112,8 @@ void USWIHubClientSubsystem::Deinitialize()
 	UE_LOG(LogTemp, Log, TEXT("[HUB] Subsystem Deinitialize"));
 
 	StopHub();
+	StopReplay();
+	StopRecording();
 
 	if (PostLoadMapHandle.IsValid())
 	{
@@ -110,6 +124,39 @@ void USWIHubClientSubsystem::Deinitialize()
 	Super::Deinitialize();
 }
 
+void USWIHubClientSubsystem::Tick(float DeltaTime)
+{
+	const double StartSec = FPlatformTime::Seconds();
+
+	if (Replay.IsValid())
+	{
+		PumpReplay_GameThread(StartSec);
+	}
+	DrainIncoming_GameThread();
+	FlushGyroBatch();
+	Watchdog.Tick(FPlatformTime::Seconds(), [this](int32 Device) { DeviceStaleNative.Broadcast(Device); });
+	TickHealth_GameThread(FPlatformTime::Seconds());
+
+	const double EndSec = FPlatformTime::Seconds();
+	Latency.Tick(EndSec);
+	LastTickMs = static_cast<float>((EndSec - StartSec) * 1000.0);
+}
+
+ETickableTickType USWIHubClientSubsystem::GetTickableTickType() const
+{
+	return IsTemplate() ? ETickableTickType::Never : ETickableTickType::Conditional;
+}
+
+bool USWIHubClientSubsystem::IsTickable() const
+{
+	return bStarted || bLocalSourceActive || Replay.IsValid() || Watchdog.HasPending();
+}
+
+TStatId USWIHubClientSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USWIHubClientSubsystem, STATGROUP_Tickables);
+}
+
 bool USWIHubClientSubsystem::IsValidGameWorld(UWorld* World) const
 {
 	return World && World->IsGameWorld() && !World->bIsTearingDown;
@@ -140,6 +187,22 @@ void USWIHubClientSubsystem::StartHub()
 	if (bStarted) return;
 	bStarted = true;
 
+	Health.PingIntervalSec = HeartbeatIntervalSec;
+	Health.DegradedSilenceSec = HeartbeatDegradedSec;
+	Health.DeadSilenceSec = HeartbeatTimeoutSec;
+	Health.DegradedRttMs = DegradedRttMs;
+	Health.ReconnectDelaySec = ReconnectDelaySec;
+	Health.MaxReconnectDelaySec = MaxReconnectDelaySec;
+	{
+		TArray<FString> Urls;
+		Urls.Add(BuildWsUrl());
+		for (const FString& Url : HubWsFailoverUrls)
+		{
+			if (!Url.IsEmpty()) Urls.AddUnique(Url);
+		}
+		Health.SetUrls(MoveTemp(Urls));
+	}
+
 	UWorld* World = GetWorld();
 	if (IsValidGameWorld(World))
 	{
@@ -163,9 +226,27 @@ void USWIHubClientSubsystem::StopHub()
 
 	StopPolling();
 	DisconnectWs();
+	Health.Reset();
+	SetConnectionState(ESWIHubConnectionState::Stopped);
+
+	// 남은 패킷은 버린다
+	ControlQueue.Reset();
+	FSWIHubImuFrame Discard;
+	while (ImuQueue.TryPop(Discard)) {}
+
+	// Nothing more will arrive, so watched devices time out now rather than never.
+	Watchdog.ExpireAll([this](int32 Device) { DeviceStaleNative.Broadcast(Device); });
 
 	LastPhoneCount = -1;
+	Devices.Reset();
+	bDeviceListPushed = false;
+	DeviceListRequestSec = 0.0;
 	ActiveWorld.Reset();
+	ClearMatches();
+	DeviceStates.Reset();
+	Coalescer.Reset();
+	BlueprintImuSentSec.Reset();
+	BlueprintImuSentButtons.Reset();
 
 	UE_LOG(LogTemp, Log, TEXT("[HUB] StopHub"));
 }
@@ -191,7 +272,6 @@ void USWIHubClientSubsystem::StopPolling()
 	if (!World) return;
 
 	World->GetTimerManager().ClearTimer(PollTimer);
-	World->GetTimerManager().ClearTimer(ReconnectTimer);
 }
 
 void USWIHubClientSubsystem::PollDevices()
@@ -200,6 +280,9 @@ void USWIHubClientSubsystem::PollDevices()
 	if (!bUseStatsPolling) return;
 	if (!bStatsEndpointAvailable) return;
 
+	// The hub pushes its device list: nothing left to poll for.
+	if (bDeviceListPushed) return;
+
 	UWorld* World = ActiveWorld.Get();
 	if (!IsValidGameWorld(World)) return;
 
@@ -245,29 +328,12 @@ void USWIHubClientSubsystem::PollDevices()
 				return;
 			}
 
-			int32 PhoneCount = 0;
-			const TArray<TSharedPtr<FJsonValue>>* ClientsArr = nullptr;
-			if (Root->TryGetArrayField(TEXT("clients"), ClientsArr) && ClientsArr)
-			{
-				for (const TSharedPtr<FJsonValue>& V : *ClientsArr)
-				{
-					const TSharedPtr<FJsonObject>* O = nullptr;
-					if (!V.IsValid() || !V->TryGetObject(O) || !O || !O->IsValid()) continue;
-
-					FString Role;
-					(*O)->TryGetStringField(TEXT("role"), Role);
-					if (Role.Equals(TEXT("phone"), ESearchCase::IgnoreCase))
-					{
-						PhoneCount++;
-					}
-				}
-			}
+			if (bDeviceListPushed) return;
 
-			if (PhoneCount != LastPhoneCount)
-			{
-				UE_LOG(LogTemp, Log, TEXT("[HUB] phone_count=%d (prev=%d)"), PhoneCount, LastPhoneCount);
-				LastPhoneCount = PhoneCount;
-			}
+			TArray<FSWIHubDeviceInfo> Clients;
+			ParseDeviceArray(Root, TEXT("clients"), Clients);
+			Devices.ApplySnapshot(MoveTemp(Clients), 0);
+			LogPhoneCount(TEXT("/stats"));
 		});
 
 	Req->ProcessRequest();
@@ -294,7 +360,12 @@ FString USWIHubClientSubsystem::BuildWsUrl() const
 	const FString EncUid = FGenericPlatformHttp::UrlEncode(ClientUid);
 	const FString EncName = FGenericPlatformHttp::UrlEncode(ClientName);
 
-	return FString::Printf(TEXT("%s/ws?role=ue&uid=%s&name=%s"), *Base, *EncUid, *EncName);
+	FString Url = FString::Printf(TEXT("%s/ws?role=ue&uid=%s&name=%s"), *Base, *EncUid, *EncName);
+	if (bPreferBinaryImu)
+	{
+		Url += FString::Printf(TEXT("&imu=%s"), SWIHubImuWire::FormatName);
+	}
+	return Url;
 }
 
 void USWIHubClientSubsystem::ConnectWs()
@@ -309,7 +380,12 @@ void USWIHubClientSubsystem::ConnectWs()
 
 	FModuleManager::LoadModuleChecked<FWebSocketsModule>("WebSockets");
 
-	const FString WsUrl = BuildWsUrl();
+	if (ConnectionState != ESWIHubConnectionState::Reconnecting)
+	{
+		SetConnectionState(ESWIHubConnectionState::Connecting);
+	}
+
+	const FString WsUrl = Health.GetUrl();
 	UE_LOG(LogTemp, Log, TEXT("[HUB] WS connect try: %s"), *WsUrl);
 
 	Socket = FWebSocketsModule::Get().CreateWebSocket(WsUrl);
@@ -317,11 +393,26 @@ void USWIHubClientSubsystem::ConnectWs()
 	Socket->OnConnected().AddLambda([this]()
 		{
 			bWsConnected = true;
-			UE_LOG(LogTemp, Log, TEXT("[HUB] WS Connected"));
+			const double Now = FPlatformTime::Seconds();
+			LastInboundSec = Now;
+			Health.NotifyConnected(Now);
+			SetConnectionState(ESWIHubConnectionState::Connected);
+			UE_LOG(LogTemp, Log, TEXT("[HUB] WS Connected: %s"), *Health.GetUrl());
+
+			// Device indices are per hub session; the hub re-announces them after hello.
+			DeviceByIndex.Reset();
+			BinaryFragment.Reset();
 
 			if (Socket.IsValid())
 			{
-				Socket->Send(TEXT("{\"type\":\"hello\",\"role\":\"ue\"}"));
+				if (bPreferBinaryImu)
+				{
+					Socket->Send(FString::Printf(TEXT("{\"type\":\"hello\",\"role\":\"ue\",\"imu_format\":\"%s\"}"), SWIHubImuWire::FormatName));
+				}
+				else
+				{
+					Socket->Send(TEXT("{\"type\":\"hello\",\"role\":\"ue\"}"));
+				}
 			}
 		});
 
@@ -341,10 +432,14 @@ void USWIHubClientSubsystem::ConnectWs()
 
 	Socket->OnMessage().AddLambda([this](const FString& Msg)
 		{
-			AsyncTask(ENamedThreads::GameThread, [this, Msg]()
-				{
-					HandleWsMessage_GameThread(Msg);
-				});
+			LastInboundSec = FPlatformTime::Seconds();
+			HandleWsMessage_GameThread(Msg);
+		});
+
+	Socket->OnBinaryMessage().AddLambda([this](const void* Data, SIZE_T Size, bool bIsLastFragment)
+		{
+			LastInboundSec = FPlatformTime::Seconds();
+			HandleWsBinary_GameThread(Data, Size, bIsLastFragment);
 		});
 
 	Socket->Connect();
@@ -378,14 +473,92 @@ void USWIHubClientSubsystem::ScheduleReconnect()
 	auto& TM = World->GetTimerManager();
 	if (TM.IsTimerActive(ReconnectTimer)) return;
 
-	TM.SetTimer(ReconnectTimer, this, &ThisClass::ConnectWs, ReconnectDelaySec, false);
-	UE_LOG(LogTemp, Log, TEXT("[HUB] WS Reconnect scheduled in %0.2fs"), ReconnectDelaySec);
+	// Next hub URL right away; once all of them failed, a jittered delay that doubles per round.
+	const float DelaySec = FMath::Max(Health.NotifyConnectionLost(FPlatformTime::Seconds()), 0.01f);
+	SetConnectionState(ESWIHubConnectionState::Reconnecting);
+
+	TM.SetTimer(ReconnectTimer, this, &ThisClass::ConnectWs, DelaySec, false);
+	UE_LOG(LogTemp, Log, TEXT("[HUB] WS Reconnect #%d to %s in %0.2fs"), Health.GetConsecutiveFailures(), *Health.GetUrl(), DelaySec);
+}
+
+void USWIHubClientSubsystem::DropSocketAndReconnect()
+{
+	if (Socket.IsValid())
+	{
+		// The close may be reported much later; its callbacks must not touch the next connection.
+		Socket->OnConnected().Clear();
+		Socket->OnConnectionError().Clear();
+		Socket->OnClosed().Clear();
+		Socket->OnMessage().Clear();
+		Socket->OnBinaryMessage().Clear();
+		Socket->Close();
+		Socket.Reset();
+	}
+
+	bWsConnected = false;
+	ScheduleReconnect();
+}
+
+void USWIHubClientSubsystem::TickHealth_GameThread(double Now)
+{
+	if (!bWsConnected || !Socket.IsValid()) return;
+
+	if (const uint32 PingId = Health.ConsumePingDue(Now))
+	{
+		Socket->Send(FString::Printf(TEXT("{\"type\":\"ping\",\"id\":%u}"), PingId));
+	}
+
+	switch (Health.Evaluate(Now, LastInboundSec))
+	{
+	case FSWIHubConnectionHealth::EVerdict::Dead:
+		UE_LOG(LogTemp, Warning, TEXT("[HUB] WS silent for %.1fs (rtt=%.0fms) -> reconnect"),
+			Now - LastInboundSec, Health.GetRttMs());
+		DropSocketAndReconnect();
+		break;
+
+	case FSWIHubConnectionHealth::EVerdict::Degraded:
+		SetConnectionState(ESWIHubConnectionState::Degraded);
+		break;
+
+	default:
+		SetConnectionState(ESWIHubConnectionState::Connected);
+		break;
+	}
+}
+
+void USWIHubClientSubsystem::SetConnectionState(ESWIHubConnectionState NewState)
+{
+	if (ConnectionState == NewState) return;
+
+	UE_LOG(LogTemp, Log, TEXT("[HUB] connection %s -> %s (rtt=%.1fms)"),
+		*UEnum::GetValueAsString(ConnectionState), *UEnum::GetValueAsString(NewState), Health.GetRttMs());
+	ConnectionState = NewState;
+	OnConnectionStateChanged.Broadcast(NewState);
 }
 
 void USWIHubClientSubsystem::HandleWsMessage_GameThread(const FString& Msg)
 {
-	OnRawMessage.Broadcast(Msg);
+	if (bLiveMuted) return;
+
+	// Game thread (socket delegates run in the WebSockets module tick). IMU is queued for the drain, not dispatched here.
+	{
+		FSWIHubImuFrame Frame;
+		if (SWIHubImuDecoder::Decode(Msg, Frame, DecodeIdentity) == ESWIHubDecodeResult::Imu)
+		{
+			if (!DecodeIdentity.Uid.IsEmpty())
+			{
+				Frame.Device = DeviceHandles.Intern(DecodeIdentity);
+				PushImuFrame_GameThread(MoveTemp(Frame));
+			}
+			if (bForwardRawImuMessages && HasRawListeners())
+			{
+				ControlQueue.Add(FControlMessage{ Msg, nullptr });
+			}
+			return;
+		}
+	}
 
+	// Anything the streaming decoder does not handle goes through the generic DOM.
 	TSharedPtr<FJsonObject> Root;
 	const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Msg);
 	if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid())
@@ -396,22 +569,213 @@ void USWIHubClientSubsystem::HandleWsMessage_GameThread(const FString& Msg)
 	FString Type;
 	Root->TryGetStringField(TEXT("type"), Type);
 
-	if (Type.Equals(TEXT("imu"), ESearchCase::IgnoreCase))
+	if (Type == TEXT("device_index"))
+	{
+		// Must be applied before the binary frames that follow it, so not via the control queue.
+		HandleDeviceIndex_GameThread(Root);
+	}
+	else if (Type.Equals(TEXT("imu"), ESearchCase::IgnoreCase))
 	{
 		FSWIHubImuFrame Frame;
-		if (TryParseImuFrame(Root, Frame))
+		FSWIHubDeviceIdentity Identity;
+		if (TryParseImuFrame(Root, Frame, Identity))
 		{
-			OnImuFrame.Broadcast(Frame);
+			Frame.Device = DeviceHandles.Intern(Identity);
+			PushImuFrame_GameThread(MoveTemp(Frame));
+		}
+
+		if (bForwardRawImuMessages && HasRawListeners())
+		{
+			ControlQueue.Add(FControlMessage{ Msg, nullptr });
 		}
 		return;
 	}
 
+	ControlQueue.Add(FControlMessage{ Msg, MoveTemp(Root) });
+}
+
+void USWIHubClientSubsystem::HandleWsBinary_GameThread(const void* Data, SIZE_T Size, bool bIsLastFragment)
+{
+	if (bLiveMuted) return;
+
+	TConstArrayView<uint8> Bytes(static_cast<const uint8*>(Data), static_cast<int32>(Size));
+
+	// Servers built on WebSocketNetworking only send binary frames, so JSON can arrive here too.
+	if (BinaryFragment.Num() == 0 && bIsLastFragment && Size > 0 && Bytes[0] != SWIHubImuWire::Magic)
+	{
+		const FUTF8ToTCHAR Text(reinterpret_cast<const ANSICHAR*>(Bytes.GetData()), Bytes.Num());
+		HandleWsMessage_GameThread(FString(Text.Length(), Text.Get()));
+		return;
+	}
+
+	// Frames are far below any fragmentation threshold, but reassemble anyway.
+	if (!bIsLastFragment || BinaryFragment.Num() > 0)
+	{
+		BinaryFragment.Append(Bytes.GetData(), Bytes.Num());
+		if (!bIsLastFragment) return;
+		Bytes = BinaryFragment;
+	}
+
+	FSWIHubImuFrame Frame;
+	uint16 DeviceIndex = 0;
+	const bool bDecoded = SWIHubImuDecoder::DecodeBinary(Bytes, DeviceIndex, Frame);
+	BinaryFragment.Reset();
+	if (!bDecoded) return;
+
+	Frame.Device = DeviceByIndex.IsValidIndex(DeviceIndex) ? DeviceByIndex[DeviceIndex] : INDEX_NONE;
+	if (Frame.Device == INDEX_NONE)
+	{
+		// Announcement not seen yet (e.g. right after reconnect).
+		return;
+	}
+
+	PushImuFrame_GameThread(MoveTemp(Frame));
+}
+
+void USWIHubClientSubsystem::HandleDeviceIndex_GameThread(const TSharedPtr<FJsonObject>& Root)
+{
+	int32 Index = INDEX_NONE;
+	FSWIHubDeviceIdentity Identity;
+	if (!Root->TryGetNumberField(TEXT("idx"), Index) || Index < 0 || Index > MAX_uint16) return;
+	if (!Root->TryGetStringField(TEXT("uid"), Identity.Uid) || Identity.Uid.IsEmpty()) return;
+	Root->TryGetStringField(TEXT("name"), Identity.Name);
+	Root->TryGetStringField(TEXT("match_id"), Identity.MatchId);
+
+	const int32 Device = DeviceHandles.Intern(Identity);
+
+	while (DeviceByIndex.Num() <= Index)
+	{
+		DeviceByIndex.Add(INDEX_NONE);
+	}
+	DeviceByIndex[Index] = Device;
+}
+
+void USWIHubClientSubsystem::PushImuFrame_GameThread(FSWIHubImuFrame&& Frame)
+{
+	if (Frame.Device == INDEX_NONE) return;
+
+	++ImuFramesReceived;
+	if (Frame.RecvTimeSec <= 0.0)
+	{
+		// Local producers stamp their own socket time; hub frames are stamped here.
+		Frame.RecvTimeSec = FPlatformTime::Seconds();
+	}
+	if (!ImuQueue.TryPush(MoveTemp(Frame)))
+	{
+		++ImuFramesDropped;
+	}
+}
+
+void USWIHubClientSubsystem::DrainIncoming_GameThread()
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(USWIHubClientSubsystem::DrainIncoming_GameThread);
+
+	// 컨트롤 메시지를 먼저 처리해야 device_connected 이후의 IMU가 올바른 상태를 본다
+	// By index: handlers may queue more (handled this tick) or stop the hub (which resets the array).
+	for (int32 Index = 0; Index < ControlQueue.Num(); ++Index)
+	{
+		const FControlMessage Ctrl = MoveTemp(ControlQueue[Index]);
+		if (Recorder.IsOpen() && Ctrl.Root.IsValid())
+		{
+			Recorder.WriteControl(Ctrl.Raw, Ctrl.RecvTimeSec);
+		}
+		HandleControlMessage_GameThread(Ctrl);
+	}
+	ControlQueue.Reset();
+
+	// At most one ring's worth per tick, so frames injected from inside a dispatch wait for the next tick.
+	const uint32 MaxBatch = ImuQueue.Capacity();
+	FSWIHubImuFrame Frame;
+	for (uint32 Count = 0; Count < MaxBatch && ImuQueue.TryPop(Frame); ++Count)
+	{
+		Frame.DequeueTimeSec = FPlatformTime::Seconds();
+		Latency.RecordArrival(Frame);
+
+		if (Recorder.IsOpen())
+		{
+			Recorder.WriteImu(Frame, DeviceHandles, Frame.RecvTimeSec);
+		}
+
+		const int32 Device = Frame.Device;
+		DeviceStates.Write(Device, Frame, Frame.RecvTimeSec);
+		Watchdog.Touch(Device, Frame.DequeueTimeSec);
+
+		if (ImuCoalescing == ESWIHubImuCoalescing::Off)
+		{
+			DispatchImuFrame_GameThread(Frame);
+		}
+		else
+		{
+			Coalescer.Add(Device, MoveTemp(Frame));
+		}
+	}
+	DeviceStates.Publish();
+
+	if (ImuCoalescing != ESWIHubImuCoalescing::Off)
+	{
+		Coalescer.MaxUncoalesced = ImuCoalescing == ESWIHubImuCoalescing::Always ? 0 : FMath::Max(ImuCoalesceThreshold, 1);
+		Coalescer.Flush([this](const FSWIHubImuFrame& Out) { DispatchImuFrame_GameThread(Out); });
+	}
+
+	const uint64 Dropped = ImuFramesDropped;
+	if (Dropped != LastReportedDropped)
+	{
+		const double Now = FPlatformTime::Seconds();
+		if ((Now - LastDropLogTime) > 1.0)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("[HUB] IMU queue overflow: dropped=%llu (+%llu) capacity=%u"),
+				Dropped, Dropped - LastReportedDropped, ImuQueue.Capacity());
+			LastReportedDropped = Dropped;
+			LastDropLogTime = Now;
+		}
+	}
+}
+
+void USWIHubClientSubsystem::HandleControlMessage_GameThread(const FControlMessage& Ctrl)
+{
+	const TSharedPtr<FJsonObject>& Root = Ctrl.Root;
+	FString Type;
+	if (Root.IsValid())
+	{
+		Root->TryGetStringField(TEXT("type"), Type);
+	}
+
+	// Heartbeat replies stay out of OnRawMessage (one per second).
+	if (Type == TEXT("pong"))
+	{
+		double Id = 0.0;
+		Root->TryGetNumberField(TEXT("id"), Id);
+		Health.NotifyPong(static_cast<uint32>(Id), Ctrl.RecvTimeSec);
+		return;
+	}
+
+	RawMessageNative.Broadcast(Ctrl.Raw);
+	if (OnRawMessage.IsBound())
+	{
+		OnRawMessage.Broadcast(Ctrl.Raw);
+	}
+
+	if (!Root.IsValid())
+	{
+		return;
+	}
+
 	if (Type == TEXT("device_connected"))
 	{
 		FSWIHubDeviceInfo D;
 		if (TryParseDeviceInfo(Root, D))
 		{
-			OnDeviceConnected.Broadcast(D);
+			DeviceHandles.InternUid(D.Uid, D.Name);
+
+			double Ver = 0.0;
+			Root->TryGetNumberField(TEXT("ver"), Ver);
+			if (Devices.ApplyConnected(D, static_cast<int64>(Ver)) == FSWIHubDeviceRegistry::EApply::Gap)
+			{
+				RequestDeviceList(Ctrl.RecvTimeSec);
+			}
+			LogPhoneCount(TEXT("device_connected"));
+			DeviceConnectedNative.Broadcast(D);
+			if (OnDeviceConnected.IsBound()) OnDeviceConnected.Broadcast(D);
 		}
 		return;
 	}
@@ -421,36 +785,607 @@ void USWIHubClientSubsystem::HandleWsMessage_GameThread(const FString& Msg)
 		FSWIHubDeviceInfo D;
 		if (TryParseDeviceInfo(Root, D))
 		{
-			OnDeviceDisconnected.Broadcast(D);
+			double Ver = 0.0;
+			Root->TryGetNumberField(TEXT("ver"), Ver);
+			if (Devices.ApplyDisconnected(D.Uid, static_cast<int64>(Ver)) == FSWIHubDeviceRegistry::EApply::Gap)
+			{
+				RequestDeviceList(Ctrl.RecvTimeSec);
+			}
+			LogPhoneCount(TEXT("device_disconnected"));
+			DeviceDisconnectedNative.Broadcast(D);
+			if (OnDeviceDisconnected.IsBound()) OnDeviceDisconnected.Broadcast(D);
+			ReleaseClaimedRoute(D.Uid);
+		}
+		return;
+	}
+
+	if (Type == TEXT("match_start"))
+	{
+		FHubMatchStart M;
+		if (TryParseMatchStart(Root, M))
+		{
+			AddMatch(M);
+			UE_LOG(LogTemp, Log, TEXT("[HUB] match_start %s players=%d matches=%d"), *M.MatchId, M.Players.Num(), Matches.Num());
+			OnMatchStart.Broadcast(M);
+		}
+		return;
+	}
+
+	if (Type == TEXT("match_end") || Type == TEXT("match_abort"))
+	{
+		FString MatchId;
+		Root->TryGetStringField(TEXT("match_id"), MatchId);
+		if (!RemoveMatch(MatchId))
+		{
+			// Started before we connected, or already ended.
+			UE_LOG(LogTemp, Verbose, TEXT("[HUB] %s for unknown match %s"), *Type, *MatchId);
+			return;
 		}
+		ImuRoutesByMatchSlot.Remove(MatchId);
+		UE_LOG(LogTemp, Log, TEXT("[HUB] %s %s matches=%d"), *Type, *MatchId, Matches.Num());
+		OnMatchEnd.Broadcast(MatchId);
 		return;
 	}
 
 	if (Type == TEXT("device_list"))
 	{
-		const TArray<TSharedPtr<FJsonValue>>* DevicesArr = nullptr;
-		int32 PhoneCount = 0;
+		TArray<FSWIHubDeviceInfo> List;
+		ParseDeviceArray(Root, TEXT("devices"), List);
+
+		double Ver = 0.0;
+		Root->TryGetNumberField(TEXT("ver"), Ver);
+		Devices.ApplySnapshot(MoveTemp(List), static_cast<int64>(Ver));
+		bDeviceListPushed = true;
+		DeviceListRequestSec = 0.0;
+
+		UE_LOG(LogTemp, Log, TEXT("[HUB] device_list ver=%lld devices=%d"), Devices.GetVersion(), Devices.Num());
+		LogPhoneCount(TEXT("device_list"));
+	}
+}
+
+void USWIHubClientSubsystem::RequestDeviceList(double Now)
+{
+	// One request in flight; a lost reply is retried by the next gap after a second.
+	if (!bWsConnected || !Socket.IsValid() || Now - DeviceListRequestSec < 1.0) return;
+
+	DeviceListRequestSec = Now;
+	Socket->Send(TEXT("{\"type\":\"device_list_request\"}"));
+	UE_LOG(LogTemp, Log, TEXT("[HUB] device list gap at ver=%lld -> resync"), Devices.GetVersion());
+}
+
+void USWIHubClientSubsystem::LogPhoneCount(const TCHAR* Source)
+{
+	const int32 PhoneCount = Devices.NumPhones();
+	if (PhoneCount != LastPhoneCount)
+	{
+		UE_LOG(LogTemp, Log, TEXT("[HUB] phone_count=%d (prev=%d, %s)"), PhoneCount, LastPhoneCount, Source);
+		LastPhoneCount = PhoneCount;
+	}
+}
+
+bool USWIHubClientSubsystem::FindDevice(const FString& Uid, FSWIHubDeviceInfo& OutDevice) const
+{
+	if (const FSWIHubDeviceInfo* Device = Devices.Find(Uid))
+	{
+		OutDevice = *Device;
+		return true;
+	}
+	return false;
+}
+
+TArray<FSWIHubDeviceInfo> USWIHubClientSubsystem::GetConnectedDevices() const
+{
+	TArray<FSWIHubDeviceInfo> Out;
+	Devices.GetDevices().GenerateValueArray(Out);
+	return Out;
+}
+
+void USWIHubClientSubsystem::DispatchImuFrame_GameThread(const FSWIHubImuFrame& Frame)
+{
+	if (const FSWIHubImuFrameNativeHandler* Handler = ResolveImuRoute(Frame.Device))
+	{
+		Handler->Execute(Frame);
+	}
+
+	ImuFrameNative.Broadcast(Frame);
 
-		if (Root->TryGetArrayField(TEXT("devices"), DevicesArr) && DevicesArr)
+	// The Blueprint event copies the frame into a parameter struct per listener, so it only runs when bound and thinned.
+	if (OnImuFrame.IsBound() && PassBlueprintImuRate(Frame))
+	{
+		FSWIHubImuFrame BlueprintFrame = Frame;
+		FillBlueprintIdentity(BlueprintFrame);
+		OnImuFrame.Broadcast(BlueprintFrame);
+	}
+}
+
+void USWIHubClientSubsystem::FillBlueprintIdentity(FSWIHubImuFrame& Frame) const
+{
+	FSWIHubDeviceIdentity Identity;
+	if (DeviceHandles.Resolve(Frame.Device, Identity))
+	{
+		Frame.MatchId = MoveTemp(Identity.MatchId);
+		Frame.Uid = MoveTemp(Identity.Uid);
+		Frame.Name = MoveTemp(Identity.Name);
+	}
+}
+
+bool USWIHubClientSubsystem::PassBlueprintImuRate(const FSWIHubImuFrame& Frame)
+{
+	if (BlueprintImuEventMaxHz <= 0.f || Frame.Device < 0) return true;
+
+	while (BlueprintImuSentSec.Num() <= Frame.Device)
+	{
+		BlueprintImuSentSec.Add(-UE_BIG_NUMBER);
+		BlueprintImuSentButtons.Add(0);
+	}
+
+	const double Now = Frame.DequeueTimeSec > 0.0 ? Frame.DequeueTimeSec : FPlatformTime::Seconds();
+	double& SentSec = BlueprintImuSentSec[Frame.Device];
+	int32& SentButtons = BlueprintImuSentButtons[Frame.Device];
+
+	// A press or release always passes, or a tap shorter than the cap's period never reaches Blueprints.
+	if (Frame.Buttons == SentButtons && Now - SentSec < 1.0 / BlueprintImuEventMaxHz) return false;
+
+	SentSec = Now;
+	SentButtons = Frame.Buttons;
+	return true;
+}
+
+void USWIHubClientSubsystem::WatchDevice(int32 Device, float TimeoutSec)
+{
+	Watchdog.Watch(Device, TimeoutSec, FPlatformTime::Seconds());
+}
+
+FSWIHubImuFrameNativeHandler USWIHubClientSubsystem::WrapDynamicHandler(const FSWIHubImuFrameHandler& Handler)
+{
+	// Weak on the listener, so IsBound / IsBoundToObject (UnbindImu) behave like the dynamic delegate's.
+	FSWIHubImuFrameHandler Copy = Handler;
+	UObject* Listener = Copy.GetUObject();
+	return FSWIHubImuFrameNativeHandler::CreateWeakLambda(Listener, [Copy = MoveTemp(Copy)](const FSWIHubImuFrame& Frame)
+	{
+		Copy.ExecuteIfBound(Frame);
+	});
+}
+
+const FSWIHubImuFrameNativeHandler* USWIHubClientSubsystem::ResolveImuRoute(int32 Device)
+{
+	if (FImuRoute* Route = ImuRoutesByDevice.Find(Device))
+	{
+		if (Route->Handler.IsBound())
+		{
+			return &Route->Handler;
+		}
+		ImuRoutesByDevice.Remove(Device);
+	}
+
+	if (const FMatchSlotRef* Ref = MatchSlotByDevice.Find(Device))
+	{
+		const FSWIHubImuFrameNativeHandler* Handler = nullptr;
+		if (const TMap<int32, FSWIHubImuFrameNativeHandler>* Slots = ImuRoutesByMatchSlot.Find(Ref->MatchId))
+		{
+			Handler = Slots->Find(Ref->Slot);
+		}
+		if (!Handler && MatchOrder.Num() > 0 && MatchOrder.Last() == Ref->MatchId)
 		{
-			for (const TSharedPtr<FJsonValue>& V : *DevicesArr)
+			if (const TMap<int32, FSWIHubImuFrameNativeHandler>* Slots = ImuRoutesByMatchSlot.Find(FString()))
 			{
-				const TSharedPtr<FJsonObject>* O = nullptr;
-				if (!V.IsValid() || !V->TryGetObject(O) || !O || !O->IsValid()) continue;
+				Handler = Slots->Find(Ref->Slot);
+			}
+		}
+		return Handler && Handler->IsBound() ? Handler : nullptr;
+	}
 
-				FString Role;
-				(*O)->TryGetStringField(TEXT("role"), Role);
-				if (Role.Equals(TEXT("phone"), ESearchCase::IgnoreCase))
-				{
-					PhoneCount++;
-				}
+	// 라우트 없는 새 기기 -> 대기 중인 리시버가 가져간다
+	while (PendingImuClaims.Num() > 0)
+	{
+		FSWIHubImuFrameNativeHandler Handler = MoveTemp(PendingImuClaims[0]);
+		PendingImuClaims.RemoveAt(0);
+		if (!Handler.IsBound()) continue;
+
+		UE_LOG(LogTemp, Log, TEXT("[HUB] IMU route claimed uid=%s by %s"), *DeviceHandles.GetUid(Device), *GetNameSafe(Handler.GetUObject()));
+		FImuRoute& Route = ImuRoutesByDevice.Add(Device, FImuRoute{ MoveTemp(Handler), true });
+		return &Route.Handler;
+	}
+
+	return nullptr;
+}
+
+void USWIHubClientSubsystem::ReleaseClaimedRoute(const FString& Uid)
+{
+	const int32 Device = DeviceHandles.Find(Uid);
+	const FImuRoute* Route = ImuRoutesByDevice.Find(Device);
+	if (!Route || !Route->bClaimed) return;
+
+	if (Route->Handler.IsBound())
+	{
+		PendingImuClaims.Insert(Route->Handler, 0);
+	}
+	ImuRoutesByDevice.Remove(Device);
+}
+
+void USWIHubClientSubsystem::AddMatch(const FHubMatchStart& Match)
+{
+	// A repeated match_start (hub reconnect) replaces the old slots.
+	RemoveMatch(Match.MatchId);
+
+	FMatchSlots& Slots = Matches.Add(Match.MatchId);
+	Slots.Match = Match;
+	MatchOrder.Add(Match.MatchId);
+
+	for (const FHubPlayerInfo& P : Match.Players)
+	{
+		const int32 Device = DeviceHandles.InternUid(P.Uid, P.Name);
+		MatchSlotByDevice.Add(Device, FMatchSlotRef{ Match.MatchId, Slots.DeviceBySlot.Add(Device) });
+	}
+}
+
+bool USWIHubClientSubsystem::RemoveMatch(const FString& MatchId)
+{
+	FMatchSlots Slots;
+	if (!Matches.RemoveAndCopyValue(MatchId, Slots)) return false;
+
+	MatchOrder.Remove(MatchId);
+	for (const int32 Device : Slots.DeviceBySlot)
+	{
+		const FMatchSlotRef* Ref = MatchSlotByDevice.Find(Device);
+		if (Ref && Ref->MatchId == MatchId)
+		{
+			MatchSlotByDevice.Remove(Device);
+		}
+	}
+	return true;
+}
+
+void USWIHubClientSubsystem::ClearMatches()
+{
+	Matches.Reset();
+	MatchOrder.Reset();
+	MatchSlotByDevice.Reset();
+}
+
+void USWIHubClientSubsystem::BindImuDevice(const FString& Uid, const FSWIHubImuFrameHandler& Handler)
+{
+	if (!Handler.IsBound()) return;
+	BindImuDeviceNative(Uid, WrapDynamicHandler(Handler));
+}
+
+void USWIHubClientSubsystem::BindImuPlayerSlot(int32 Slot, const FSWIHubImuFrameHandler& Handler)
+{
+	if (!Handler.IsBound()) return;
+	BindImuPlayerSlotNative(Slot, WrapDynamicHandler(Handler));
+}
+
+void USWIHubClientSubsystem::BindImuMatchSlot(const FString& MatchId, int32 Slot, const FSWIHubImuFrameHandler& Handler)
+{
+	if (!Handler.IsBound()) return;
+	BindImuMatchSlotNative(MatchId, Slot, WrapDynamicHandler(Handler));
+}
+
+void USWIHubClientSubsystem::BindImuNextDevice(const FSWIHubImuFrameHandler& Handler)
+{
+	if (!Handler.IsBound()) return;
+	BindImuNextDeviceNative(WrapDynamicHandler(Handler));
+}
+
+void USWIHubClientSubsystem::BindImuDeviceNative(const FString& Uid, FSWIHubImuFrameNativeHandler&& Handler)
+{
+	if (Uid.IsEmpty() || !Handler.IsBound()) return;
+
+	// The device may not have connected yet; its handle is reserved now.
+	ImuRoutesByDevice.Add(DeviceHandles.InternUid(Uid), FImuRoute{ MoveTemp(Handler), false });
+}
+
+void USWIHubClientSubsystem::BindImuPlayerSlotNative(int32 Slot, FSWIHubImuFrameNativeHandler&& Handler)
+{
+	BindImuMatchSlotNative(FString(), Slot, MoveTemp(Handler));
+}
+
+void USWIHubClientSubsystem::BindImuMatchSlotNative(const FString& MatchId, int32 Slot, FSWIHubImuFrameNativeHandler&& Handler)
+{
+	if (Slot < 0 || !Handler.IsBound()) return;
+
+	// The match may not have started yet (bound ahead of match_start); the route waits for it.
+	ImuRoutesByMatchSlot.FindOrAdd(MatchId).Add(Slot, MoveTemp(Handler));
+}
+
+void USWIHubClientSubsystem::BindImuNextDeviceNative(FSWIHubImuFrameNativeHandler&& Handler)
+{
+	if (!Handler.IsBound()) return;
+	PendingImuClaims.Add(MoveTemp(Handler));
+}
+
+void USWIHubClientSubsystem::UnbindImu(const UObject* Listener)
+{
+	if (!Listener) return;
+
+	for (auto It = ImuRoutesByDevice.CreateIterator(); It; ++It)
+	{
+		if (It.Value().Handler.IsBoundToObject(Listener)) It.RemoveCurrent();
+	}
+	for (auto MatchIt = ImuRoutesByMatchSlot.CreateIterator(); MatchIt; ++MatchIt)
+	{
+		for (auto It = MatchIt.Value().CreateIterator(); It; ++It)
+		{
+			if (It.Value().IsBoundToObject(Listener)) It.RemoveCurrent();
+		}
+		if (MatchIt.Value().Num() == 0) MatchIt.RemoveCurrent();
+	}
+	PendingImuClaims.RemoveAll([Listener](const FSWIHubImuFrameNativeHandler& H) { return H.IsBoundToObject(Listener); });
+}
+
+int32 USWIHubClientSubsystem::AcquireGyroLane(USWIGyroInputReceiverComponent* Receiver)
+{
+	const int32 Lane = GyroBatch.AddLane();
+	if (GyroLaneOwners.Num() <= Lane)
+	{
+		GyroLaneOwners.SetNum(Lane + 1);
+	}
+	GyroLaneOwners[Lane] = Receiver;
+	return Lane;
+}
+
+void USWIHubClientSubsystem::ReleaseGyroLane(int32 Lane)
+{
+	if (!GyroLaneOwners.IsValidIndex(Lane)) return;
+
+	GyroBatch.RemoveLane(Lane);
+	GyroLaneOwners[Lane].Reset();
+}
+
+void USWIHubClientSubsystem::FlushGyroBatch()
+{
+	if (!GyroBatch.HasPending()) return;
+
+	TRACE_CPUPROFILER_EVENT_SCOPE(USWIHubClientSubsystem::FlushGyroBatch);
+	GyroBatch.Run([this](int32 Lane, const FSWIGyroBatchResult& Result)
+	{
+		if (USWIGyroInputReceiverComponent* Receiver = GyroLaneOwners.IsValidIndex(Lane) ? GyroLaneOwners[Lane].Get() : nullptr)
+		{
+			Receiver->ApplyBatchedResult(Result);
+		}
+	});
+}
+
+void USWIHubClientSubsystem::InjectImuFrame(FSWIHubImuFrame&& Frame)
+{
+	PushImuFrame_GameThread(MoveTemp(Frame));
+}
+
+void USWIHubClientSubsystem::InjectControlMessage(const FString& Json)
+{
+	HandleWsMessage_GameThread(Json);
+}
+
+bool USWIHubClientSubsystem::StartReplay(const FString& Path, float Speed, bool bLoop)
+{
+	StopReplay();
+
+	Replay = FSWIHubTrafficReader::Open(Path);
+	if (!Replay.IsValid())
+	{
+		UE_LOG(LogTemp, Error, TEXT("[HUB] Replay: cannot open %s"), *Path);
+		return false;
+	}
+
+	ReplaySpeed = FMath::Max(Speed, 0.f);
+	bReplayLoop = bLoop;
+	ReplayStartSec = FPlatformTime::Seconds();
+	bReplayHasNext = Replay->Next(ReplayNext);
+	bLiveMuted = bMuteLiveDuringReplay;
+
+	UE_LOG(LogTemp, Log, TEXT("[HUB] Replay: %s speed=%s loop=%d"), *Path,
+		ReplaySpeed > 0.f ? *FString::Printf(TEXT("%.2fx"), ReplaySpeed) : TEXT("max"), bLoop ? 1 : 0);
+	return true;
+}
+
+void USWIHubClientSubsystem::StopReplay()
+{
+	if (!Replay.IsValid()) return;
+
+	Replay.Reset();
+	bReplayHasNext = false;
+	bLiveMuted = false;
+	UE_LOG(LogTemp, Log, TEXT("[HUB] Replay: stopped"));
+}
+
+void USWIHubClientSubsystem::PumpReplay_GameThread(double Now)
+{
+	// Never more than the ring can take in one tick, so "as fast as possible" does not turn into drops.
+	const uint32 Budget = ImuQueue.Capacity() / 2;
+	for (uint32 Count = 0; Count < Budget && bReplayHasNext; ++Count)
+	{
+		const double DueSec = ReplaySpeed > 0.f ? ReplayStartSec + ReplayNext.TimeSec / ReplaySpeed : Now;
+		if (DueSec > Now) break;
+
+		if (ReplayNext.Kind == FSWIHubTrafficRecord::EKind::Imu)
+		{
+			// Arrival is the scheduled time, so the receive-side timing matches the recording even between ticks.
+			ReplayNext.Frame.RecvTimeSec = DueSec;
+			ReplayNext.Frame.Device = DeviceHandles.Intern(ReplayNext.Identity);
+			PushImuFrame_GameThread(MoveTemp(ReplayNext.Frame));
+		}
+		else
+		{
+			TSharedPtr<FJsonObject> Root;
+			if (FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(ReplayNext.Json), Root) && Root.IsValid())
+			{
+				ControlQueue.Add(FControlMessage{ MoveTemp(ReplayNext.Json), MoveTemp(Root), DueSec });
 			}
 		}
 
-		if (PhoneCount != LastPhoneCount)
+		bReplayHasNext = Replay->Next(ReplayNext);
+		if (!bReplayHasNext && bReplayLoop && Replay->Rewind())
 		{
-			LastPhoneCount = PhoneCount;
-			UE_LOG(LogTemp, Log, TEXT("[HUB] device_list phone_count=%d"), PhoneCount);
+			ReplayStartSec = Now;
+			bReplayHasNext = Replay->Next(ReplayNext);
 		}
 	}
+
+	if (!bReplayHasNext)
+	{
+		UE_LOG(LogTemp, Log, TEXT("[HUB] Replay: end of recording"));
+		StopReplay();
+	}
+}
+
+bool USWIHubClientSubsystem::StartRecording(const FString& Path)
+{
+	const FString FilePath = !Path.IsEmpty() ? Path
+		: FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("HubRecordings"), FDateTime::Now().ToString(TEXT("Hub_%Y%m%d_%H%M%S.swirec")));
+
+	if (!Recorder.Open(FilePath))
+	{
+		UE_LOG(LogTemp, Error, TEXT("[HUB] Record: cannot write %s"), *FilePath);
+		return false;
+	}
+	UE_LOG(LogTemp, Log, TEXT("[HUB] Record: %s"), *FilePath);
+	return true;
+}
+
+void USWIHubClientSubsystem::StopRecording()
+{
+	if (!Recorder.IsOpen()) return;
+
+	Recorder.Close();
+	UE_LOG(LogTemp, Log, TEXT("[HUB] Record: stopped, %llu records in %s"), Recorder.GetNumRecords(), *Recorder.GetPath());
+}
+
+void USWIHubClientSubsystem::RecordImuApplied(int32 Device, double TsMs, double DequeueTimeSec)
+{
+	Latency.RecordApply(Device, TsMs, DequeueTimeSec, FPlatformTime::Seconds());
+}
+
+FString USWIHubClientSubsystem::GetPlayerSlotUid(int32 Slot, const FString& MatchId) const
+{
+	const FString& Id = MatchId.IsEmpty() && MatchOrder.Num() > 0 ? MatchOrder.Last() : MatchId;
+	const FMatchSlots* Slots = Matches.Find(Id);
+	return Slots && Slots->Match.Players.IsValidIndex(Slot) ? Slots->Match.Players[Slot].Uid : FString();
+}
+
+int32 USWIHubClientSubsystem::GetMatchSlotCount() const
+{
+	return GetCurrentMatch().Players.Num();
+}
+
+FHubMatchStart USWIHubClientSubsystem::GetCurrentMatch() const
+{
+	const FMatchSlots* Slots = MatchOrder.Num() > 0 ? Matches.Find(MatchOrder.Last()) : nullptr;
+	return Slots ? Slots->Match : FHubMatchStart();
+}
+
+TArray<FHubMatchStart> USWIHubClientSubsystem::GetActiveMatches() const
+{
+	TArray<FHubMatchStart> Out;
+	Out.Reserve(MatchOrder.Num());
+	for (const FString& Id : MatchOrder)
+	{
+		Out.Add(Matches.FindChecked(Id).Match);
+	}
+	return Out;
+}
+
+bool USWIHubClientSubsystem::GetLatestImu(const FString& Uid, FSWIHubImuFrame& OutFrame) const
+{
+	const int32 Index = DeviceHandles.Find(Uid);
+	const FSWIHubDeviceStateBuffer& Snap = DeviceStates.GetSnapshot();
+	if (Index == INDEX_NONE || Index >= Snap.Num() || Snap.FrameCount[Index] == 0)
+	{
+		return false;
+	}
+
+	OutFrame.Device = Index;
+	OutFrame.TsMs = Snap.TsMs[Index];
+	OutFrame.RecvTimeSec = Snap.RecvTimeSec[Index];
+	OutFrame.Yaw = Snap.Euler[Index].X;
+	OutFrame.Pitch = Snap.Euler[Index].Y;
+	OutFrame.Roll = Snap.Euler[Index].Z;
+	OutFrame.Ax = Snap.Accel[Index].X;
+	OutFrame.Ay = Snap.Accel[Index].Y;
+	OutFrame.Az = Snap.Accel[Index].Z;
+	OutFrame.Gx = Snap.Gyro[Index].X;
+	OutFrame.Gy = Snap.Gyro[Index].Y;
+	OutFrame.Gz = Snap.Gyro[Index].Z;
+	OutFrame.Seq = Snap.Seq[Index];
+	OutFrame.Buttons = Snap.Buttons[Index];
+	OutFrame.Fire = (Snap.Buttons[Index] & SWIHubImuWire::ButtonFire) ? 1 : 0;
+	FillBlueprintIdentity(OutFrame);
+	return true;
+}
+
+static USWIHubClientSubsystem* FindHubForCommand(UWorld* World)
+{
+	UGameInstance* GI = World ? World->GetGameInstance() : nullptr;
+	USWIHubClientSubsystem* Hub = GI ? GI->GetSubsystem<USWIHubClientSubsystem>() : nullptr;
+	if (!Hub)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("[HUB] No hub subsystem in this world"));
+	}
+	return Hub;
+}
+
+// SWI.Hub.Latency [reset]
+// Per-device p50/p95/p99/max for each stage from phone send to controller apply.
+static void RunHubLatencyCommand(const TArray<FString>& Args, UWorld* World)
+{
+	USWIHubClientSubsystem* Hub = FindHubForCommand(World);
+	if (!Hub) return;
+
+	if (Args.Num() > 0 && Args[0].Equals(TEXT("reset"), ESearchCase::IgnoreCase))
+	{
+		Hub->GetLatency().Reset();
+		UE_LOG(LogTemp, Log, TEXT("[HUB] Latency histograms reset"));
+		return;
+	}
+
+	Hub->GetLatency().LogReport([Hub](int32 Device) { return Hub->GetDeviceUid(Device); });
+}
+
+static FAutoConsoleCommandWithWorldAndArgs GSWIHubLatencyCmd(
+	TEXT("SWI.Hub.Latency"),
+	TEXT("Print per-device IMU latency percentiles per pipeline stage (see also 'stat SWIInputLatency'). Args: [reset]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&RunHubLatencyCommand)
+);
+
+// SWI.Hub.Replay <path> [speed] [loop] | stop
+static void RunHubReplayCommand(const TArray<FString>& Args, UWorld* World)
+{
+	USWIHubClientSubsystem* Hub = FindHubForCommand(World);
+	if (!Hub) return;
+
+	if (Args.Num() == 0 || Args[0].Equals(TEXT("stop"), ESearchCase::IgnoreCase))
+	{
+		Hub->StopReplay();
+		return;
+	}
+
+	const float Speed = Args.Num() > 1 ? FCString::Atof(*Args[1]) : 1.f;
+	const bool bLoop = Args.Num() > 2 && Args[2].ToBool();
+	Hub->StartReplay(Args[0], Speed, bLoop);
+}
+
+static FAutoConsoleCommandWithWorldAndArgs GSWIHubReplayCmd(
+	TEXT("SWI.Hub.Replay"),
+	TEXT("Replay a .swirec or gyro_log.ndjson into the hub pipeline. Args: <path> [speed, 0 = max] [loop] | stop"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&RunHubReplayCommand)
+);
+
+// SWI.Hub.Record [path] | stop
+static void RunHubRecordCommand(const TArray<FString>& Args, UWorld* World)
+{
+	USWIHubClientSubsystem* Hub = FindHubForCommand(World);
+	if (!Hub) return;
+
+	if (Args.Num() > 0 && Args[0].Equals(TEXT("stop"), ESearchCase::IgnoreCase))
+	{
+		Hub->StopRecording();
+		return;
+	}
+
+	Hub->StartRecording(Args.Num() > 0 ? Args[0] : FString());
 }
+
+static FAutoConsoleCommandWithWorldAndArgs GSWIHubRecordCmd(
+	TEXT("SWI.Hub.Record"),
+	TEXT("Record ingested hub traffic to a compact .swirec file. Args: [path] | stop"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&RunHubRecordCommand)
+);
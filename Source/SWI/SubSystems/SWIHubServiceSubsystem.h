@@ -2,16 +2,40 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "Tickable.h"
 #include "SWI/SWIHubProtocolTypes.h"
+#include "SWI/Hub/SWIHubFrameQueue.h"
+#include "SWI/Hub/SWIHubDeviceStateStore.h"
+#include "SWI/Hub/SWIHubDeviceRegistry.h"
+#include "SWI/Hub/SWIHubDeviceHandles.h"
+#include "SWI/Hub/SWIHubDeviceWatchdog.h"
+#include "SWI/Hub/SWIHubImuCoalescer.h"
+#include "SWI/Gyro/SWIGyroBatch.h"
+#include "SWI/Hub/SWIHubLatencyStats.h"
+#include "SWI/Hub/SWIHubTrafficLog.h"
+#include "SWI/Hub/SWIHubConnectionHealth.h"
 #include "IWebSocket.h"
 #include "SWIHubServiceSubsystem.generated.h"
 
+class FJsonObject;
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSWIHubRawMessageSig, const FString&, Raw);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSWIHubImuFrameSig, const FSWIHubImuFrame&, Frame);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSWIHubDeviceSig, const FSWIHubDeviceInfo&, Device);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSWIHubMatchStartSig, const FHubMatchStart&, Match);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSWIHubMatchEndSig, const FString&, MatchId);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FSWIHubConnectionStateSig, ESWIHubConnectionState, State);
+DECLARE_DYNAMIC_DELEGATE_OneParam(FSWIHubImuFrameHandler, const FSWIHubImuFrame&, Frame);
+
+// Native counterparts for C++ consumers: no reflection or parameter marshalling per call.
+DECLARE_MULTICAST_DELEGATE_OneParam(FSWIHubRawMessageNativeSig, const FString&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FSWIHubImuFrameNativeSig, const FSWIHubImuFrame&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FSWIHubDeviceNativeSig, const FSWIHubDeviceInfo&);
+DECLARE_DELEGATE_OneParam(FSWIHubImuFrameNativeHandler, const FSWIHubImuFrame&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FSWIHubDeviceStaleNativeSig, int32 /*Device*/);
 
 UCLASS()
-class SWI_API USWIHubClientSubsystem : public UGameInstanceSubsystem
+class SWI_API USWIHubClientSubsystem : public UGameInstanceSubsystem, public FTickableGameObject
 {
 	GENERATED_BODY()
 
@@ -19,15 +43,60 @@ public:
 	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
 	virtual void Deinitialize() override;
 
+	// FTickableGameObject
+	virtual void Tick(float DeltaTime) override;
+	virtual ETickableTickType GetTickableTickType() const override;
+	virtual bool IsTickable() const override;
+	virtual bool IsTickableWhenPaused() const override { return true; }
+	virtual TStatId GetStatId() const override;
+	// ~FTickableGameObject
+
 	UFUNCTION(BlueprintCallable, Category = "HUB")
 	void StartHub();
 
 	UFUNCTION(BlueprintCallable, Category = "HUB")
 	void StopHub();
 
+	UFUNCTION(BlueprintPure, Category = "HUB")
+	bool IsHubStarted() const { return bStarted; }
+
+	// Takes effect on the next StartHub. Empty = derive from HubHttpBaseUrl.
+	void SetHubWsUrlOverride(const FString& Url) { HubWsUrlOverride = Url; }
+	const FString& GetHubWsUrlOverride() const { return HubWsUrlOverride; }
+
+	// Connection health
+	UPROPERTY(BlueprintAssignable, Category = "HUB|Connection")
+	FSWIHubConnectionStateSig OnConnectionStateChanged;
+
+	UFUNCTION(BlueprintPure, Category = "HUB|Connection")
+	ESWIHubConnectionState GetConnectionState() const { return ConnectionState; }
+
+	// Smoothed ping RTT to the hub, 0 until the hub answered a ping.
+	UFUNCTION(BlueprintPure, Category = "HUB|Connection")
+	float GetHubRttMs() const { return Health.GetRttMs(); }
+
+	UFUNCTION(BlueprintPure, Category = "HUB|Connection")
+	float GetHubRttJitterMs() const { return Health.GetRttVarMs(); }
+
+	UFUNCTION(BlueprintPure, Category = "HUB|Connection")
+	FString GetActiveHubUrl() const { return Health.GetUrl(); }
+
+	const FSWIHubConnectionHealth& GetConnectionHealth() const { return Health; }
+	// ~Connection health
+
+	// Native events fire first; the Blueprint events below are only marshalled when something is bound to them.
+	FSWIHubRawMessageNativeSig& OnRawMessageNative() { return RawMessageNative; }
+	FSWIHubImuFrameNativeSig& OnImuFrameNative() { return ImuFrameNative; }
+	FSWIHubDeviceNativeSig& OnDeviceConnectedNative() { return DeviceConnectedNative; }
+	FSWIHubDeviceNativeSig& OnDeviceDisconnectedNative() { return DeviceDisconnectedNative; }
+
+	// A watched device sent no IMU frame for its timeout (or the hub stopped). Fires once; the next frame re-arms it.
+	FSWIHubDeviceStaleNativeSig& OnDeviceStaleNative() { return DeviceStaleNative; }
+
 	UPROPERTY(BlueprintAssignable, Category = "HUB")
 	FSWIHubRawMessageSig OnRawMessage;
 
+	// Thinned to BlueprintImuEventMaxHz per device; C++ consumers that need every frame use OnImuFrameNative.
 	UPROPERTY(BlueprintAssignable, Category = "HUB")
 	FSWIHubImuFrameSig OnImuFrame;
 
@@ -37,11 +106,166 @@ public:
 	UPROPERTY(BlueprintAssignable, Category = "HUB")
 	FSWIHubDeviceSig OnDeviceDisconnected;
 
+	UPROPERTY(BlueprintAssignable, Category = "HUB")
+	FSWIHubMatchStartSig OnMatchStart;
+
+	// match_end or match_abort for MatchId; that match's slots are already cleared, other matches keep theirs.
+	UPROPERTY(BlueprintAssignable, Category = "HUB")
+	FSWIHubMatchEndSig OnMatchEnd;
+
+	// Routing: each IMU frame goes to the single handler routed to its device, then to OnImuFrame.
+	UFUNCTION(BlueprintCallable, Category = "HUB|Routing")
+	void BindImuDevice(const FString& Uid, const FSWIHubImuFrameHandler& Handler);
+
+	// Slot = index into the players of the newest match_start. Use BindImuMatchSlot when matches run side by side.
+	UFUNCTION(BlueprintCallable, Category = "HUB|Routing")
+	void BindImuPlayerSlot(int32 Slot, const FSWIHubImuFrameHandler& Handler);
+
+	// Slot = index into the players of match_start MatchId.
+	UFUNCTION(BlueprintCallable, Category = "HUB|Routing")
+	void BindImuMatchSlot(const FString& MatchId, int32 Slot, const FSWIHubImuFrameHandler& Handler);
+
+	// Claims the first device that sends IMU without a route; released again when that device disconnects.
+	UFUNCTION(BlueprintCallable, Category = "HUB|Routing")
+	void BindImuNextDevice(const FSWIHubImuFrameHandler& Handler);
+
+	UFUNCTION(BlueprintCallable, Category = "HUB|Routing")
+	void UnbindImu(const UObject* Listener);
+
+	// Same routes for C++ handlers. Bind with a UObject (CreateUObject / CreateWeakLambda) so UnbindImu finds them.
+	void BindImuDeviceNative(const FString& Uid, FSWIHubImuFrameNativeHandler&& Handler);
+	void BindImuPlayerSlotNative(int32 Slot, FSWIHubImuFrameNativeHandler&& Handler);
+	void BindImuMatchSlotNative(const FString& MatchId, int32 Slot, FSWIHubImuFrameNativeHandler&& Handler);
+	void BindImuNextDeviceNative(FSWIHubImuFrameNativeHandler&& Handler);
+
+	// Empty MatchId = newest match.
+	UFUNCTION(BlueprintPure, Category = "HUB|Routing")
+	FString GetPlayerSlotUid(int32 Slot, const FString& MatchId = TEXT("")) const;
+
+	// Players in the newest match (0 = no match).
+	UFUNCTION(BlueprintPure, Category = "HUB|Routing")
+	int32 GetMatchSlotCount() const;
+
+	// Newest match still running.
+	UFUNCTION(BlueprintPure, Category = "HUB|Routing")
+	FHubMatchStart GetCurrentMatch() const;
+
+	// Every match still running, oldest first. The hub pairs phones into several matches at once.
+	UFUNCTION(BlueprintPure, Category = "HUB|Routing")
+	TArray<FHubMatchStart> GetActiveMatches() const;
+	// ~Routing
+
+	// Devices: connected to the hub (pushed deltas), whether or not they have sent IMU yet.
+	UFUNCTION(BlueprintPure, Category = "HUB|Devices")
+	int32 GetPhoneCount() const { return Devices.NumPhones(); }
+
+	UFUNCTION(BlueprintPure, Category = "HUB|Devices")
+	bool IsDeviceConnected(const FString& Uid) const { return Devices.Find(Uid) != nullptr; }
+
+	UFUNCTION(BlueprintPure, Category = "HUB|Devices")
+	bool FindDevice(const FString& Uid, FSWIHubDeviceInfo& OutDevice) const;
+
+	// Copy of the whole list (O(n)); prefer FindDevice / GetPhoneCount per frame.
+	UFUNCTION(BlueprintCallable, Category = "HUB|Devices")
+	TArray<FSWIHubDeviceInfo> GetConnectedDevices() const;
+
+	const FSWIHubDeviceRegistry& GetDeviceRegistry() const { return Devices; }
+
+	// Device handles: FSWIHubImuFrame::Device. Stable for the game instance; INDEX_NONE = uid never seen.
+	UFUNCTION(BlueprintPure, Category = "HUB|Devices")
+	int32 GetDeviceHandle(const FString& Uid) const { return DeviceHandles.Find(Uid); }
+
+	UFUNCTION(BlueprintPure, Category = "HUB|Devices")
+	FString GetDeviceUid(int32 Device) const { return DeviceHandles.GetUid(Device); }
+
+	UFUNCTION(BlueprintPure, Category = "HUB|Devices")
+	FString GetDeviceName(int32 Device) const { return DeviceHandles.GetName(Device); }
+
+	UFUNCTION(BlueprintPure, Category = "HUB|Devices")
+	FString GetDeviceMatchId(int32 Device) const { return DeviceHandles.GetMatchId(Device); }
+
+	FSWIHubDeviceHandles& GetDeviceHandles() { return DeviceHandles; }
+	const FSWIHubDeviceHandles& GetDeviceHandles() const { return DeviceHandles; }
+
+	// IMU timeouts, checked once per hub tick for every device instead of by each consumer.
+	void WatchDevice(int32 Device, float TimeoutSec);
+	void UnwatchDevice(int32 Device) { Watchdog.Unwatch(Device); }
+	bool IsDeviceLive(int32 Device) const { return Watchdog.IsLive(Device); }
+	// ~Devices
+
+	// Latest state: polled from the snapshot published once per tick.
+	UFUNCTION(BlueprintPure, Category = "HUB|State")
+	bool GetLatestImu(const FString& Uid, FSWIHubImuFrame& OutFrame) const;
+
+	UFUNCTION(BlueprintPure, Category = "HUB|State")
+	int32 GetKnownDeviceCount() const { return DeviceStates.NumDevices(); }
+
+	const FSWIHubDeviceStateStore& GetDeviceStates() const { return DeviceStates; }
+	// ~Latest state
+
+	UFUNCTION(BlueprintPure, Category = "HUB|Stats")
+	int64 GetImuFramesReceived() const { return static_cast<int64>(ImuFramesReceived); }
+
+	UFUNCTION(BlueprintPure, Category = "HUB|Stats")
+	int64 GetImuFramesDropped() const { return static_cast<int64>(ImuFramesDropped); }
+
+	// Game-thread cost of the last Tick (drain, routing, handlers), ms.
+	UFUNCTION(BlueprintPure, Category = "HUB|Stats")
+	float GetLastTickMs() const { return LastTickMs; }
+
+	// Frames that were folded into a newer one instead of being dispatched.
+	UFUNCTION(BlueprintPure, Category = "HUB|Stats")
+	int64 GetImuFramesCoalesced() const { return static_cast<int64>(Coalescer.GetNumFolded()); }
+
+	// Batched gyro math: receivers with bBatchedMath hold a lane; every pending lane runs in one pass after the drain.
+	int32 AcquireGyroLane(class USWIGyroInputReceiverComponent* Receiver);
+	void ReleaseGyroLane(int32 Lane);
+	FSWIGyroBatch& GetGyroBatch() { return GyroBatch; }
+	void FlushGyroBatch();
+
+	// Local producers (USWIHubServerSubsystem) feed the same pipeline as the hub socket. Game thread.
+	void InjectImuFrame(FSWIHubImuFrame&& Frame);
+	void InjectControlMessage(const FString& Json);
+
+	// Keeps the drain ticking while a local producer is running, even without a hub connection.
+	void SetLocalSourceActive(bool bActive) { bLocalSourceActive = bActive; }
+
+	// Replay: streams a .swirec recording or the hub's gyro_log.ndjson into the ingestion path.
+	// Speed 1 = original timing, N = N times faster, 0 = as fast as the queue accepts.
+	UFUNCTION(BlueprintCallable, Category = "HUB|Replay")
+	bool StartReplay(const FString& Path, float Speed = 1.f, bool bLoop = false);
+
+	UFUNCTION(BlueprintCallable, Category = "HUB|Replay")
+	void StopReplay();
+
+	UFUNCTION(BlueprintPure, Category = "HUB|Replay")
+	bool IsReplaying() const { return Replay.IsValid(); }
+
+	// Captures every ingested IMU frame and control message. Empty path = Saved/HubRecordings/<timestamp>.swirec.
+	UFUNCTION(BlueprintCallable, Category = "HUB|Replay")
+	bool StartRecording(const FString& Path);
+
+	UFUNCTION(BlueprintCallable, Category = "HUB|Replay")
+	void StopRecording();
+
+	UFUNCTION(BlueprintPure, Category = "HUB|Replay")
+	bool IsRecording() const { return Recorder.IsOpen(); }
+	// ~Replay
+
+	// Latency: the controller reports when input built from a device's newest sample was applied.
+	void RecordImuApplied(int32 Device, double TsMs, double DequeueTimeSec);
+
+	FSWIHubLatencyTracker& GetLatency() { return Latency; }
+	const FSWIHubLatencyTracker& GetLatency() const { return Latency; }
+
 private:
 	// WebSockets
 	void ConnectWs();
 	void DisconnectWs();
 	void ScheduleReconnect();
+	void DropSocketAndReconnect();
+	void TickHealth_GameThread(double Now);
+	void SetConnectionState(ESWIHubConnectionState NewState);
 	FString BuildWsUrl() const;
 	// ~WebSockets
 
@@ -54,15 +278,52 @@ private:
 	// ~Polling
 	 
 	// Parse Helper
-	static bool TryGetNumberAsFloat(const TSharedPtr<FJsonObject>& Root, const TCHAR* Key, float& Out);
 	bool TryParseDeviceInfo(const TSharedPtr<FJsonObject>& Root, FSWIHubDeviceInfo& Out) const;
-	bool TryParseImuFrame(const TSharedPtr<FJsonObject>& Root, FSWIHubImuFrame& Out) const;
+	void ParseDeviceArray(const TSharedPtr<FJsonObject>& Root, const TCHAR* Field, TArray<FSWIHubDeviceInfo>& Out) const;
+	bool TryParseImuFrame(const TSharedPtr<FJsonObject>& Root, FSWIHubImuFrame& Out, FSWIHubDeviceIdentity& OutIdentity) const;
+	bool TryParseMatchStart(const TSharedPtr<FJsonObject>& Root, FHubMatchStart& Out) const;
 	// ~Parse Helper
 
 	// Message
+	struct FControlMessage
+	{
+		FString Raw;
+		TSharedPtr<FJsonObject> Root;
+		double RecvTimeSec = FPlatformTime::Seconds();
+	};
+
+	// The stock WebSockets backends call their delegates from the module tick, so parsing runs on the game thread;
+	// frames then wait in ImuQueue for the drain, which dispatches them once per tick.
 	void HandleWsMessage_GameThread(const FString& Msg);
+	void HandleWsBinary_GameThread(const void* Data, SIZE_T Size, bool bIsLastFragment);
+	void HandleDeviceIndex_GameThread(const TSharedPtr<FJsonObject>& Root);
+	void PushImuFrame_GameThread(FSWIHubImuFrame&& Frame);
+	void DrainIncoming_GameThread();
+	void HandleControlMessage_GameThread(const FControlMessage& Ctrl);
+	void DispatchImuFrame_GameThread(const FSWIHubImuFrame& Frame);
+	void PumpReplay_GameThread(double Now);
+	void RequestDeviceList(double Now);
+	void LogPhoneCount(const TCHAR* Source);
 	// ~Message
 
+	// Routing
+	struct FImuRoute
+	{
+		FSWIHubImuFrameNativeHandler Handler;
+		bool bClaimed = false;
+	};
+
+	static FSWIHubImuFrameNativeHandler WrapDynamicHandler(const FSWIHubImuFrameHandler& Handler);
+	const FSWIHubImuFrameNativeHandler* ResolveImuRoute(int32 Device);
+	bool PassBlueprintImuRate(const FSWIHubImuFrame& Frame);
+	bool HasRawListeners() const { return OnRawMessage.IsBound() || RawMessageNative.IsBound(); }
+	void FillBlueprintIdentity(FSWIHubImuFrame& Frame) const;
+	void ReleaseClaimedRoute(const FString& Uid);
+	void AddMatch(const FHubMatchStart& Match);
+	bool RemoveMatch(const FString& MatchId);
+	void ClearMatches();
+	// ~Routing
+
 private:
 	// Settings
 	UPROPERTY(EditAnywhere, Category = "HUB|Config")
@@ -77,12 +338,65 @@ private:
 	UPROPERTY(EditAnywhere, Category = "HUB|Config")
 	FString ClientName = TEXT("UE");
 
-	UPROPERTY(EditAnywhere, Category = "HUB|Config")
+	// First retry after every hub URL failed; doubles per failed round up to MaxReconnectDelaySec, jittered to 50-100%.
+	UPROPERTY(EditAnywhere, Category = "HUB|Connection", meta = (ClampMin = "0"))
 	float ReconnectDelaySec = 1.0f;
 
+	UPROPERTY(EditAnywhere, Category = "HUB|Connection", meta = (ClampMin = "0"))
+	float MaxReconnectDelaySec = 30.0f;
+
+	// Tried in order after the primary URL (override or HubHttpBaseUrl); ws:// or wss:// with the full query.
+	UPROPERTY(EditAnywhere, Category = "HUB|Connection")
+	TArray<FString> HubWsFailoverUrls;
+
+	// Application-level ping for RTT and silence detection. 0 = off.
+	UPROPERTY(EditAnywhere, Category = "HUB|Connection", meta = (ClampMin = "0"))
+	float HeartbeatIntervalSec = 1.0f;
+
+	// No traffic (pongs included) for this long = Degraded; for HeartbeatTimeoutSec = drop and reconnect.
+	UPROPERTY(EditAnywhere, Category = "HUB|Connection", meta = (ClampMin = "0"))
+	float HeartbeatDegradedSec = 2.0f;
+
+	UPROPERTY(EditAnywhere, Category = "HUB|Connection", meta = (ClampMin = "0"))
+	float HeartbeatTimeoutSec = 5.0f;
+
+	// Smoothed RTT above this = Degraded. 0 = RTT is not judged.
+	UPROPERTY(EditAnywhere, Category = "HUB|Connection", meta = (ClampMin = "0"))
+	float DegradedRttMs = 150.0f;
+
 	UPROPERTY(EditAnywhere, Category = "HUB|Config")
 	bool bAutoStart = true;
 
+	// Bounded IMU ring between the socket callbacks and the once-per-tick drain (rounded up to a power of two).
+	UPROPERTY(EditAnywhere, Category = "HUB|Config", meta = (ClampMin = "16"))
+	int32 ImuQueueCapacity = 1024;
+
+	// IMU packets also reach OnRawMessage / OnRawMessageNative. Costs nothing while neither is bound; turn off to keep
+	// raw listeners on control messages only.
+	UPROPERTY(EditAnywhere, Category = "HUB|Config")
+	bool bForwardRawImuMessages = true;
+
+	// Per-device cap on the Blueprint OnImuFrame event; frames that change the buttons always pass. 0 = every frame.
+	UPROPERTY(EditAnywhere, Category = "HUB|Config", meta = (ClampMin = "0"))
+	float BlueprintImuEventMaxHz = 30.f;
+
+	// Ask the hub for compact binary IMU frames (hello imu_format=bin1). JSON frames are still accepted.
+	UPROPERTY(EditAnywhere, Category = "HUB|Config")
+	bool bPreferBinaryImu = false;
+
+	// After a hitch, fold each device's backlog into one frame per tick (newest pose, integrated gyro) instead of delivering it all.
+	// Buttons are never merged: a frame whose buttons change is delivered as its own frame, so presses keep their TsMs.
+	UPROPERTY(EditAnywhere, Category = "HUB|Config")
+	ESWIHubImuCoalescing ImuCoalescing = ESWIHubImuCoalescing::OnBacklog;
+
+	// OnBacklog: frames one device may deliver individually in a tick before the rest are folded.
+	UPROPERTY(EditAnywhere, Category = "HUB|Config", meta = (ClampMin = "1", EditCondition = "ImuCoalescing == ESWIHubImuCoalescing::OnBacklog"))
+	int32 ImuCoalesceThreshold = 4;
+
+	// Drop live hub traffic while a replay runs, so the replayed session is reproduced exactly.
+	UPROPERTY(EditAnywhere, Category = "HUB|Replay")
+	bool bMuteLiveDuringReplay = true;
+
 	UPROPERTY(EditAnywhere, Category = "HUB|Polling")
 	bool bUseStatsPolling = false;
 
@@ -91,14 +405,90 @@ private:
 
 	bool bStarted = false;
 	bool bWsConnected = false;
+	bool bLocalSourceActive = false;
 
 	bool bStatsEndpointAvailable = true;
 	int32 LastPhoneCount = -1;
 
+	FSWIHubDeviceRegistry Devices;
+	bool bDeviceListPushed = false;
+	double DeviceListRequestSec = 0.0;
+
 	TWeakObjectPtr<UWorld> ActiveWorld;
 	FTimerHandle PollTimer;
 	FTimerHandle ReconnectTimer;
 	FDelegateHandle PostLoadMapHandle;
 
 	TSharedPtr<class IWebSocket> Socket;
+
+	FSWIHubConnectionHealth Health;
+	ESWIHubConnectionState ConnectionState = ESWIHubConnectionState::Stopped;
+	double LastInboundSec = 0.0;
+
+	// Ingestion
+	TSWIHubBoundedQueue<FSWIHubImuFrame> ImuQueue;
+	TArray<FControlMessage> ControlQueue;		// drained in order each tick; keeps its capacity
+
+	// Uid <-> handle for every device seen; frames carry only the handle.
+	FSWIHubDeviceHandles DeviceHandles;
+
+	// Binary frames only carry the hub's device index; "device_index" maps it to a device handle.
+	TArray<int32> DeviceByIndex;
+	TArray<uint8> BinaryFragment;
+
+	// Reused by the streaming decoder so the identity strings keep their capacity: a known device costs no allocation.
+	FSWIHubDeviceIdentity DecodeIdentity;
+
+	// Routing (game thread), keyed by device handle
+	TMap<int32, FImuRoute> ImuRoutesByDevice;
+	TArray<FSWIHubImuFrameNativeHandler> PendingImuClaims;
+
+	// Matches (game thread), keyed by match_id
+	struct FMatchSlots
+	{
+		FHubMatchStart Match;
+		TArray<int32> DeviceBySlot;
+	};
+	struct FMatchSlotRef
+	{
+		FString MatchId;
+		int32 Slot = INDEX_NONE;
+	};
+	TMap<FString, FMatchSlots> Matches;
+	TArray<FString> MatchOrder;		// oldest first
+	TMap<int32, FMatchSlotRef> MatchSlotByDevice;
+	TMap<FString, TMap<int32, FSWIHubImuFrameNativeHandler>> ImuRoutesByMatchSlot;		// "" = newest match
+
+	FSWIHubRawMessageNativeSig RawMessageNative;
+	FSWIHubImuFrameNativeSig ImuFrameNative;
+	FSWIHubDeviceNativeSig DeviceConnectedNative;
+	FSWIHubDeviceNativeSig DeviceDisconnectedNative;
+	FSWIHubDeviceStaleNativeSig DeviceStaleNative;
+	FSWIHubDeviceWatchdog Watchdog;
+	TArray<double> BlueprintImuSentSec;		// by device handle
+	TArray<int32> BlueprintImuSentButtons;	// by device handle
+	// ~Routing
+
+	FSWIHubDeviceStateStore DeviceStates;
+	FSWIHubImuCoalescer Coalescer;
+	FSWIHubLatencyTracker Latency;
+	FSWIGyroBatch GyroBatch;
+	TArray<TWeakObjectPtr<class USWIGyroInputReceiverComponent>> GyroLaneOwners;
+
+	// Replay / record (game thread)
+	TUniquePtr<FSWIHubTrafficReader> Replay;
+	FSWIHubTrafficRecord ReplayNext;
+	bool bReplayHasNext = false;
+	bool bReplayLoop = false;
+	float ReplaySpeed = 1.f;
+	double ReplayStartSec = 0.0;
+	bool bLiveMuted = false;
+	FSWIHubTrafficRecorder Recorder;
+
+	uint64 ImuFramesReceived = 0;
+	uint64 ImuFramesDropped = 0;
+	uint64 LastReportedDropped = 0;
+	float LastTickMs = 0.f;
+	double LastDropLogTime = 0.0;
+	// ~Ingestion
 };
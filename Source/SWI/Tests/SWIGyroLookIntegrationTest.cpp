@@ -0,0 +1,65 @@
+#include "Misc/AutomationTest.h"
+#include "SWI/Gyro/SWIGyroLookIntegrator.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Replays a fixed 100 Hz gyro stream (delivered in Wi-Fi style bursts, with duplicates and a late packet)
+// at 30, 60 and 144 fps; every tick rate must end with the same total rotation.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSWIGyroLookIntegrationTest, "SWI.Gyro.LookIntegration",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FSWIGyroLookIntegrationTest::RunTest(const FString& Parameters)
+{
+	constexpr float SmoothingHz = 18.f;
+
+	struct FSample
+	{
+		double TsMs;
+		double RecvSec;
+		float RateDegPerSec;
+	};
+
+	TArray<FSample> Stream;
+	double Expected = 0.0;
+	int32 ExpectedDropped = 0;
+	for (int32 i = 0; i < 200; ++i)
+	{
+		const double Ts = 1000.0 + i * 10.0;
+		const float Rate = 90.f * FMath::Sin(i * 0.05f);
+		// 4 packets per burst, every 40 ms
+		const double Recv = 0.05 + (i / 4) * 0.04;
+		Stream.Add({ Ts, Recv, Rate });
+
+		if (i > 0) Expected += Rate * 0.01;
+		if (i % 25 == 0) { Stream.Add({ Ts, Recv, Rate }); ++ExpectedDropped; }				// duplicate
+		if (i == 120) { Stream.Add({ Ts - 30.0, Recv, 500.f }); ++ExpectedDropped; }		// late
+	}
+
+	for (const float Fps : { 30.f, 60.f, 144.f })
+	{
+		FSWIGyroLookIntegrator Integrator;
+		const float Dt = 1.f / Fps;
+		double Total = 0.0;
+		int32 Next = 0;
+
+		for (double Now = 0.0; Now < 3.0; Now += Dt)
+		{
+			for (; Next < Stream.Num() && Stream[Next].RecvSec <= Now; ++Next)
+			{
+				const FSample& S = Stream[Next];
+				const float SampleDt = Integrator.AdvanceSample(S.TsMs, S.RecvSec);
+				if (SampleDt < 0.f) continue;
+				Integrator.AddDelta(FVector2D(S.RateDegPerSec * SampleDt, 0.f));
+			}
+			Total += Integrator.Consume(Dt, SmoothingHz).X;
+		}
+
+		TestEqual(*FString::Printf(TEXT("total rotation at %.0f fps"), Fps), Total, Expected, 0.01);
+		TestEqual(*FString::Printf(TEXT("dropped samples at %.0f fps"), Fps), static_cast<int32>(Integrator.GetNumDroppedSamples()), ExpectedDropped);
+		TestTrue(*FString::Printf(TEXT("reservoir drained at %.0f fps"), Fps), Integrator.GetPending().IsNearlyZero(0.01));
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,91 @@
+#include "Misc/AutomationTest.h"
+#include "SWI/Gyro/SWIGyroLookIntegrator.h"
+#include "SWI/Gyro/SWIGyroLookPredictor.h"
+#include "Math/RandomStream.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// A phone swings +-40 deg at 0.5 and 1 Hz, sampled at 100 Hz and delivered after 30 ms plus up to 20 ms jitter.
+// The view is released at 60 fps with 18 Hz smoothing; prediction must lower both the error against the true phone
+// angle and its frame-to-frame change, and give its lead back once the stream stops.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSWIGyroLookPredictionTest, "SWI.Gyro.LookPrediction",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FSWIGyroLookPredictionTest::RunTest(const FString& Parameters)
+{
+	constexpr float NetworkSec = 0.03f;
+	constexpr float SmoothingHz = 18.f;
+	constexpr float FrameDt = 1.f / 60.f;
+	constexpr double StreamSec = 6.0;
+
+	for (const float Freq : { 0.5f, 1.f })
+	{
+		auto Angle = [Freq](double T) { return 40.0 * FMath::Sin(2.0 * UE_DOUBLE_PI * Freq * T); };
+
+		struct FSample { double TsSec; double RecvSec; };
+		TArray<FSample> Stream;
+		FRandomStream Rng(7);
+		for (double Ts = 0.0; Ts < StreamSec; Ts += 0.01)
+		{
+			Stream.Add({ Ts, Ts + NetworkSec + Rng.FRandRange(0.f, 0.02f) });
+		}
+		Stream.Sort([](const FSample& A, const FSample& B) { return A.RecvSec < B.RecvSec; });
+
+		double Rms[2] = { 0.0, 0.0 };
+		double Jitter[2] = { 0.0, 0.0 };
+		for (int32 bPredict = 0; bPredict < 2; ++bPredict)
+		{
+			FSWIGyroLookIntegrator Integrator;
+			FSWIGyroLookPredictor Predictor;
+			double Shown = 0.0, PrevErr = 0.0, LastTs = -1.0;
+			int32 Next = 0, NumErr = 0;
+
+			// Runs a second past the stream so a stall is covered too.
+			for (double Now = 0.0; Now < StreamSec + 1.0; Now += FrameDt)
+			{
+				for (; Next < Stream.Num() && Stream[Next].RecvSec <= Now; ++Next)
+				{
+					const FSample& S = Stream[Next];
+					if (LastTs >= 0.0 && S.TsSec > LastTs)
+					{
+						const FVector2D Delta(Angle(S.TsSec) - Angle(LastTs), 0.0);
+						Integrator.AddDelta(Delta);
+						Predictor.AddSample(Delta, static_cast<float>(S.TsSec - LastTs), S.RecvSec);
+					}
+					LastTs = FMath::Max(LastTs, S.TsSec);
+				}
+
+				double Out = Integrator.Consume(FrameDt, SmoothingHz).X;
+				if (bPredict)
+				{
+					Out += Predictor.Consume(Now, FrameDt, NetworkSec + 1.f / SmoothingHz).X;
+				}
+				Shown += Out;
+
+				if (Now > 1.0 && Now < StreamSec)
+				{
+					const double Err = Shown - Angle(Now);
+					Rms[bPredict] += Err * Err;
+					if (NumErr > 0) Jitter[bPredict] += FMath::Square(Err - PrevErr);
+					PrevErr = Err;
+					++NumErr;
+				}
+			}
+			Rms[bPredict] = FMath::Sqrt(Rms[bPredict] / NumErr);
+			Jitter[bPredict] = FMath::Sqrt(Jitter[bPredict] / NumErr);
+
+			if (bPredict)
+			{
+				TestTrue(*FString::Printf(TEXT("%.1f Hz: lead given back after the stream stops"), Freq), Predictor.GetLead().IsNearlyZero(0.01));
+			}
+		}
+
+		AddInfo(FString::Printf(TEXT("%.1f Hz: rms %.2f -> %.2f deg, frame jitter %.3f -> %.3f deg"), Freq, Rms[0], Rms[1], Jitter[0], Jitter[1]));
+		TestTrue(*FString::Printf(TEXT("%.1f Hz: prediction lowers the rms error"), Freq), Rms[1] < Rms[0]);
+		TestTrue(*FString::Printf(TEXT("%.1f Hz: prediction adds no frame jitter"), Freq), Jitter[1] <= Jitter[0]);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
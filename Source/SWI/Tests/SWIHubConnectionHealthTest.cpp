@@ -0,0 +1,67 @@
+#include "Misc/AutomationTest.h"
+#include "SWI/Hub/SWIHubConnectionHealth.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Three hub URLs that keep failing: each round walks all three at the failover delay, round delays double within
+// their jitter band up to the cap, and a connection that stayed up resets the schedule.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSWIHubBackoffTest, "SWI.Hub.Backoff",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FSWIHubBackoffTest::RunTest(const FString& Parameters)
+{
+	FSWIHubConnectionHealth Health;
+	Health.ReconnectDelaySec = 1.f;
+	Health.MaxReconnectDelaySec = 8.f;
+	Health.SetUrls({ TEXT("ws://a"), TEXT("ws://b"), TEXT("ws://c") });
+
+	double Now = 0.0;
+	for (int32 Attempt = 1; Attempt <= 18; ++Attempt)
+	{
+		const float Delay = Health.NotifyConnectionLost(Now);
+		Now += Delay;
+
+		const int32 Round = Attempt / 3;
+		if (Attempt % 3 == 0)
+		{
+			const float Nominal = FMath::Min(1.f * (1 << FMath::Max(Round - 1, 0)), 8.f);
+			TestTrue(*FString::Printf(TEXT("attempt %d: round delay %.2f within [%.2f, %.2f]"), Attempt, Delay, Nominal * 0.5f, Nominal),
+				Delay >= Nominal * 0.5f && Delay <= Nominal);
+		}
+		else
+		{
+			TestEqual(*FString::Printf(TEXT("attempt %d: failover delay"), Attempt), Delay, Health.FailoverDelaySec);
+		}
+		TestEqual(*FString::Printf(TEXT("attempt %d: url"), Attempt), Health.GetUrl(),
+			FString(Attempt % 3 == 0 ? TEXT("ws://a") : Attempt % 3 == 1 ? TEXT("ws://b") : TEXT("ws://c")));
+	}
+
+	// Stable connection, then a drop: back to the failover delay and the next URL.
+	Health.NotifyConnected(Now);
+	TestEqual(TEXT("delay after a stable connection"), Health.NotifyConnectionLost(Now + Health.StableAfterSec + 1.0), Health.FailoverDelaySec);
+	TestEqual(TEXT("failures after a stable connection"), Health.GetConsecutiveFailures(), 1);
+
+	// Flapping connection (drops right away) keeps counting.
+	Health.NotifyConnected(Now);
+	Health.NotifyConnectionLost(Now + 0.5);
+	TestEqual(TEXT("failures after a flapping connection"), Health.GetConsecutiveFailures(), 2);
+
+	// RTT: answered pings feed the estimate, stale or repeated ids do not.
+	Health.NotifyConnected(100.0);
+	const uint32 First = Health.ConsumePingDue(100.0);
+	TestNotEqual(TEXT("ping due on connect"), First, 0u);
+	Health.NotifyPong(First, 100.020);
+	Health.NotifyPong(First, 100.500);
+	TestEqual(TEXT("rtt from the first pong only"), Health.GetRttMs(), 20.f, 0.01f);
+	TestTrue(TEXT("pong support seen"), Health.HasPongSupport());
+	TestEqual(TEXT("no ping before the interval"), Health.ConsumePingDue(100.5), 0u);
+
+	using EVerdict = FSWIHubConnectionHealth::EVerdict;
+	TestTrue(TEXT("healthy after 1 s of silence"), Health.Evaluate(101.0, 100.020) == EVerdict::Healthy);
+	TestTrue(TEXT("degraded after 2.5 s of silence"), Health.Evaluate(102.5, 100.020) == EVerdict::Degraded);
+	TestTrue(TEXT("dead after 6 s of silence"), Health.Evaluate(106.0, 100.020) == EVerdict::Dead);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,61 @@
+#include "Misc/AutomationTest.h"
+#include "SWI/Hub/SWIHubDeviceHandles.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Handles are dense and stable, re-interning a known identity changes nothing, and a name or match change bumps
+// the revision.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSWIHubDeviceHandlesTest, "SWI.Hub.DeviceHandles",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FSWIHubDeviceHandlesTest::RunTest(const FString& Parameters)
+{
+	FSWIHubDeviceHandles Handles;
+
+	const int32 A = Handles.InternUid(TEXTVIEW("phone-a"), TEXTVIEW("Alice"));
+	const int32 B = Handles.Intern(TEXTVIEW("phone-b"), TEXTVIEW("Bob"), TEXTVIEW(""));
+	TestEqual(TEXT("first handle"), A, 0);
+	TestEqual(TEXT("second handle"), B, 1);
+	TestEqual(TEXT("count"), Handles.Num(), 2);
+
+	// Same identity: same handle, same revision.
+	const uint32 RevA = Handles.GetRevision(A);
+	TestEqual(TEXT("known identity keeps its handle"), Handles.Intern(TEXTVIEW("phone-a"), TEXTVIEW("Alice"), TEXTVIEW("")), A);
+	TestEqual(TEXT("known identity keeps its revision"), Handles.GetRevision(A), RevA);
+
+	// Frames without a name keep it; a match id is taken as is.
+	TestEqual(TEXT("match change keeps the handle"), Handles.Intern(TEXTVIEW("phone-a"), TEXTVIEW(""), TEXTVIEW("m1")), A);
+	TestEqual(TEXT("match change bumps the revision"), Handles.GetRevision(A), RevA + 1);
+	TestEqual(TEXT("empty name keeps the known one"), Handles.GetName(A), FString(TEXT("Alice")));
+	TestEqual(TEXT("match id"), Handles.GetMatchId(A), FString(TEXT("m1")));
+
+	// device_connected does not clear the match; a reconnect keeps the handle.
+	TestEqual(TEXT("reconnect keeps the handle"), Handles.InternUid(TEXTVIEW("phone-a")), A);
+	TestEqual(TEXT("reconnect keeps the match"), Handles.GetMatchId(A), FString(TEXT("m1")));
+	TestEqual(TEXT("unknown uid"), Handles.Find(TEXTVIEW("phone-c")), INDEX_NONE);
+	TestEqual(TEXT("uid by handle"), Handles.GetUid(B), FString(TEXT("phone-b")));
+
+	FSWIHubDeviceIdentity Identity;
+	TestTrue(TEXT("resolve a known handle"), Handles.Resolve(B, Identity));
+	TestEqual(TEXT("resolved name"), Identity.Name, FString(TEXT("Bob")));
+	TestFalse(TEXT("resolve an unknown handle"), Handles.Resolve(7, Identity));
+
+	// Steady state: interning a known identity from FStrings adds nothing.
+	const FString Uid = TEXT("phone-b");
+	const FString Name = TEXT("Bob");
+	const uint32 RevB = Handles.GetRevision(B);
+	for (int32 i = 0; i < 1000; ++i)
+	{
+		if (Handles.Intern(Uid, Name, FStringView()) != B)
+		{
+			AddError(FString::Printf(TEXT("intern %d returned another handle"), i));
+			break;
+		}
+	}
+	TestEqual(TEXT("count after repeated interns"), Handles.Num(), 2);
+	TestEqual(TEXT("revision after repeated interns"), Handles.GetRevision(B), RevB);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,84 @@
+#include "Misc/AutomationTest.h"
+#include "SWI/Hub/SWIHubDeviceWatchdog.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// Deadlines slide with traffic, a quiet device fires exactly once and re-arms on its next frame, unwatched devices
+// never fire, and a crowd of streaming devices stays quiet until it stops.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSWIHubDeviceWatchdogTest, "SWI.Hub.DeviceWatchdog",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FSWIHubDeviceWatchdogTest::RunTest(const FString& Parameters)
+{
+	TArray<int32> Fired;
+	auto Collect = [&Fired](int32 Device) { Fired.Add(Device); };
+
+	{
+		FSWIHubDeviceWatchdog Watchdog;
+		Watchdog.Watch(0, 0.25f, 0.0);
+		Watchdog.Touch(0, 0.1);
+		Watchdog.Touch(0, 0.2);
+		Watchdog.Touch(1, 0.2);		// not watched
+
+		Watchdog.Tick(0.3, Collect);	// first deadline (0.25) slides to 0.45
+		TestEqual(TEXT("nothing fires while traffic slides the deadline"), Fired.Num(), 0);
+		TestTrue(TEXT("device live while streaming"), Watchdog.IsLive(0));
+
+		Watchdog.Tick(0.46, Collect);
+		Watchdog.Tick(1.0, Collect);
+		TestEqual(TEXT("quiet device fires once"), Fired, TArray<int32>{ 0 });
+		TestFalse(TEXT("quiet device not live"), Watchdog.IsLive(0));
+
+		Watchdog.Touch(0, 1.1);
+		TestTrue(TEXT("next frame re-arms the device"), Watchdog.IsLive(0));
+		Watchdog.Tick(1.36, Collect);
+		TestEqual(TEXT("re-armed device fires again"), Fired.Num(), 2);
+
+		// A shorter timeout takes effect at once; a dropped watch never fires.
+		Fired.Reset();
+		Watchdog.Watch(2, 1.f, 2.0);
+		Watchdog.Watch(2, 0.1f, 2.0);
+		Watchdog.Watch(3, 0.1f, 2.0);
+		Watchdog.Unwatch(3);
+		Watchdog.Tick(2.15, Collect);
+		TestEqual(TEXT("shorter timeout fires, unwatched device does not"), Fired, TArray<int32>{ 2 });
+
+		Watchdog.Touch(2, 2.2);
+		Fired.Reset();
+		Watchdog.ExpireAll(Collect);
+		Watchdog.Tick(10.0, Collect);
+		TestEqual(TEXT("expire all fires each live device once"), Fired, TArray<int32>{ 2 });
+		TestFalse(TEXT("nothing pending after expire all"), Watchdog.HasPending());
+	}
+
+	// Every device streaming at 120 Hz, ticked at 60 Hz for 10 s: nothing should fire.
+	constexpr int32 NumDevices = 100;
+	FSWIHubDeviceWatchdog Watchdog;
+	for (int32 Device = 0; Device < NumDevices; ++Device)
+	{
+		Watchdog.Watch(Device, 0.25f, 0.0);
+	}
+
+	Fired.Reset();
+	for (int32 Step = 1; Step <= 1200; ++Step)
+	{
+		const double Now = Step / 120.0;
+		for (int32 Device = 0; Device < NumDevices; ++Device)
+		{
+			Watchdog.Touch(Device, Now);
+		}
+		if (Step % 2 == 0)
+		{
+			Watchdog.Tick(Now, Collect);
+		}
+	}
+	TestEqual(TEXT("streaming devices never fire"), Fired.Num(), 0);
+
+	// Then everyone goes quiet.
+	Watchdog.Tick(10.0 + 0.25, Collect);
+	TestEqual(TEXT("every quiet device fires"), Fired.Num(), NumDevices);
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,139 @@
+#include "Misc/AutomationTest.h"
+#include "SWI/Hub/SWIHubImuCoalescer.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+// A 100 Hz stream with a 400 ms game-thread hitch (plus a duplicate, a one-sample tap and a three-sample hold inside
+// it), drained per tick with and without coalescing. Rotation, button edges, hold times and sequence continuity must
+// match; dispatches must not.
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSWIHubImuCoalescingTest, "SWI.Hub.Coalescing",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::EngineFilter)
+
+bool FSWIHubImuCoalescingTest::RunTest(const FString& Parameters)
+{
+	struct FTick
+	{
+		TArray<FSWIHubImuFrame> Frames;
+	};
+
+	TArray<FTick> Ticks;
+	{
+		int32 Sample = 0;
+		auto MakeFrame = [&Sample](bool bFire)
+		{
+			FSWIHubImuFrame Frame;
+			Frame.Device = 0;
+			Frame.TsMs = 1000.0 + Sample * 10.0;
+			Frame.Gz = 120.f * FMath::Sin(Sample * 0.07f);
+			Frame.Seq = Sample + 1;
+			Frame.Buttons = bFire ? 1 : 0;
+			Frame.Fire = Frame.Buttons;
+			++Sample;
+			return Frame;
+		};
+
+		// 60 fps, ~1.7 samples per tick; tick 30 is a 400 ms hitch that drains 40 samples at once.
+		for (int32 t = 0; t < 90; ++t)
+		{
+			FTick& Tick = Ticks.AddDefaulted_GetRef();
+			const int32 Count = t == 30 ? 40 : (t % 3 == 0 ? 1 : 2);
+			for (int32 i = 0; i < Count; ++i)
+			{
+				Tick.Frames.Add(MakeFrame(t == 30 && (i == 17 || (i >= 25 && i < 28))));
+				if (t == 30 && i == 5)
+				{
+					Tick.Frames.Add(Tick.Frames.Last());	// duplicate
+				}
+			}
+		}
+	}
+
+	struct FResult
+	{
+		double Rotation = 0.0;
+		int32 Presses = 0;
+		int32 Releases = 0;
+		int32 SeqGaps = 0;
+		double HoldMs = 0.0;
+		int32 Dispatches = 0;
+	};
+
+	auto Run = [&Ticks](int32 MaxUncoalesced, bool bCoalesce)
+	{
+		FResult Result;
+		FSWIHubImuCoalescer Coalescer;
+		Coalescer.MaxUncoalesced = MaxUncoalesced;
+
+		double LastTsMs = 0.0;
+		int64 LastSeq = 0;
+		int32 Held = 0;
+		double PressTsMs = 0.0;
+		auto Consume = [&Result, &LastTsMs, &LastSeq, &Held, &PressTsMs](const FSWIHubImuFrame& Frame)
+		{
+			++Result.Dispatches;
+
+			// Same rules as the receiver: duplicates by Seq are dropped, a jump past NumSamples is a gap.
+			if (Frame.Seq <= LastSeq) return;
+			Result.SeqGaps += Frame.Seq > LastSeq + Frame.NumSamples ? 1 : 0;
+			LastSeq = Frame.Seq;
+
+			if (Frame.Buttons & ~Held)
+			{
+				++Result.Presses;
+				PressTsMs = Frame.TsMs;
+			}
+			if (Held & ~Frame.Buttons)
+			{
+				++Result.Releases;
+				Result.HoldMs += Frame.TsMs - PressTsMs;
+			}
+			Held = Frame.Buttons;
+
+			if (LastTsMs > 0.0 && Frame.TsMs > LastTsMs)
+			{
+				Result.Rotation += Frame.Gz * (Frame.TsMs - LastTsMs) * 0.001;
+			}
+			LastTsMs = FMath::Max(LastTsMs, Frame.TsMs);
+		};
+
+		for (const FTick& Tick : Ticks)
+		{
+			for (FSWIHubImuFrame Frame : Tick.Frames)
+			{
+				if (bCoalesce)
+				{
+					Coalescer.Add(0, MoveTemp(Frame));
+				}
+				else
+				{
+					Consume(Frame);
+				}
+			}
+			Coalescer.Flush(Consume);
+		}
+		return Result;
+	};
+
+	// Uncoalesced delivery must see both presses, both releases and no gaps, or the stream itself is broken.
+	const FResult Off = Run(0, false);
+	TestEqual(TEXT("uncoalesced presses"), Off.Presses, 2);
+	TestEqual(TEXT("uncoalesced releases"), Off.Releases, 2);
+	TestEqual(TEXT("uncoalesced sequence gaps"), Off.SeqGaps, 0);
+
+	for (const int32 MaxUncoalesced : { 4, 0 })
+	{
+		const FResult On = Run(MaxUncoalesced, true);
+		const TCHAR* Mode = MaxUncoalesced > 0 ? TEXT("on backlog") : TEXT("always");
+
+		TestEqual(*FString::Printf(TEXT("%s: rotation"), Mode), On.Rotation, Off.Rotation, 0.01);
+		TestEqual(*FString::Printf(TEXT("%s: presses"), Mode), On.Presses, Off.Presses);
+		TestEqual(*FString::Printf(TEXT("%s: releases"), Mode), On.Releases, Off.Releases);
+		TestEqual(*FString::Printf(TEXT("%s: hold time"), Mode), On.HoldMs, Off.HoldMs);
+		TestEqual(*FString::Printf(TEXT("%s: sequence gaps"), Mode), On.SeqGaps, 0);
+		TestTrue(*FString::Printf(TEXT("%s: fewer dispatches (%d vs %d)"), Mode, On.Dispatches, Off.Dispatches), On.Dispatches < Off.Dispatches);
+	}
+
+	return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS